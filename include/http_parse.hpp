@@ -22,12 +22,17 @@
 //   线程安全的并发操作
 // =============================================================================
 
+#include "http_parse/arena.hpp"
 #include "http_parse/buffer.hpp"
 #include "http_parse/builder.hpp"
 #include "http_parse/core.hpp"
 #include "http_parse/encoder.hpp"
 #include "http_parse/parser.hpp"
+#include "http_parse/pool.hpp"
+#include "http_parse/uri.hpp"
+#include "http_parse/v2/frame_batch.hpp"
 #include "http_parse/v2/frame_processor.hpp"
+#include "http_parse/v2/registered_buffers.hpp"
 #include <concepts>
 #include <functional>
 #include <memory>
@@ -100,6 +105,44 @@ parse_response(std::string_view data) {
   return p.parse_response(data);
 }
 
+/**
+ * @brief Parse an HTTP/1.x request without copying (zero-copy)
+ * @brief 零拷贝解析HTTP/1.x请求
+ *
+ * @param data The raw HTTP request data; must outlive the returned view / 原始HTTP请求数据；必须比返回的视图存活更久
+ * @return std::expected<request_view, error_code> Parsed request view or error / 解析的请求视图或错误
+ *
+ * @details The returned view's URI, header names/values and body are
+ * std::string_views into `data` — no per-header allocations are made.
+ * Intended for proxy-style hot paths that inspect but never mutate the message.
+ * @details 返回视图的URI、头部名称/值和正文都是指向`data`的std::string_view
+ * —— 不进行每个头部的分配。适用于只检查而不修改消息的代理热路径。
+ *
+ * @example
+ * auto result = http1::parse_request_view(buffer);
+ * if (result) {
+ *   auto host = result->get_header("host");
+ * }
+ */
+inline std::expected<request_view, error_code>
+parse_request_view(std::string_view data) {
+  parser p(version::http_1_1);
+  return p.parse_request_view(data);
+}
+
+/**
+ * @brief Parse an HTTP/1.x response without copying (zero-copy)
+ * @brief 零拷贝解析HTTP/1.x响应
+ *
+ * @param data The raw HTTP response data; must outlive the returned view / 原始HTTP响应数据；必须比返回的视图存活更久
+ * @return std::expected<response_view, error_code> Parsed response view or error / 解析的响应视图或错误
+ */
+inline std::expected<response_view, error_code>
+parse_response_view(std::string_view data) {
+  parser p(version::http_1_1);
+  return p.parse_response_view(data);
+}
+
 // =============================================================================
 // Simple Encode Functions (One-shot encoding) / 简单编码函数（一次性编码）
 // High-level functions for encoding HTTP messages to wire format
@@ -719,13 +762,12 @@ public:
   std::expected<size_t, v2::h2_error_code>
   process(std::span<const uint8_t> data) {
     if (!preface_sent_ && !is_server_) {
-      // Client must send preface first
-      output_buffer buffer;
-      if (auto result = processor_.generate_connection_preface(buffer);
-          !result) {
-        return result;
-      }
-      preface_data_ = buffer.to_string();
+      // Client must send the preamble first; it is a precomputed immutable
+      // blob (preface magic + empty initial SETTINGS), so connection setup
+      // is a 33-byte copy
+      auto preamble = v2::frame_processor::client_preamble();
+      preface_data_.assign(reinterpret_cast<const char *>(preamble.data()),
+                           preamble.size());
       preface_sent_ = true;
     }
 
@@ -926,6 +968,16 @@ public:
   // =============================================================================
 
   // Send settings
+  std::expected<output_buffer, v2::h2_error_code>
+  send_settings(std::span<const v2::setting> settings) {
+    output_buffer buffer;
+    auto result = processor_.generate_settings_frame(settings, false, buffer);
+    if (!result) {
+      return std::unexpected{result.error()};
+    }
+    return buffer;
+  }
+
   std::expected<output_buffer, v2::h2_error_code>
   send_settings(const std::unordered_map<uint16_t, uint32_t> &settings) {
     output_buffer buffer;
@@ -939,7 +991,8 @@ public:
   // Send settings ACK
   std::expected<output_buffer, v2::h2_error_code> send_settings_ack() {
     output_buffer buffer;
-    auto result = processor_.generate_settings_frame({}, true, buffer);
+    auto result = processor_.generate_settings_frame(
+        std::span<const v2::setting>{}, true, buffer);
     if (!result) {
       return std::unexpected{result.error()};
     }
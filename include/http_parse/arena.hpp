@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace co::http {
+
+// =============================================================================
+// Per-Connection Message Arena
+// =============================================================================
+
+// Bump allocator for parsed-message storage. All header-name, header-value
+// and body bytes for the messages of one connection are copied into large
+// contiguous blocks and handed out as string_views; reset() reclaims
+// everything wholesale between requests on a keep-alive connection instead
+// of freeing each string individually.
+class message_arena {
+public:
+    static constexpr size_t default_block_size = 16 * 1024;
+
+    explicit message_arena(size_t block_size = default_block_size);
+
+    // Non-copyable, movable
+    message_arena(const message_arena&) = delete;
+    message_arena& operator=(const message_arena&) = delete;
+    message_arena(message_arena&&) = default;
+    message_arena& operator=(message_arena&&) = default;
+
+    // Raw bump allocation; the returned memory lives until reset()
+    char* allocate(size_t size);
+
+    // Copy `data` into the arena and return a view of the stable copy
+    std::string_view copy(std::string_view data);
+
+    // Reclaim all allocations at once; retains the first block's capacity
+    void reset() noexcept;
+
+    // Bytes handed out since the last reset()
+    size_t bytes_used() const noexcept;
+
+private:
+    struct block {
+        std::unique_ptr<char[]> data;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    void add_block(size_t min_size);
+
+    std::vector<block> blocks_;
+    size_t block_size_;
+    size_t bytes_used_ = 0;
+};
+
+} // namespace co::http
+
+// Include implementation
+#include "detail/arena_impl.hpp"
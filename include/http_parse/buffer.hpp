@@ -1,9 +1,13 @@
 #pragma once
 
+#include "detail/stats.hpp"
+#include <memory>
 #include <string>
 #include <string_view>
 #include <span>
+#include <sys/uio.h>
 #include <cstdint>
+#include <vector>
 
 namespace co::http {
 
@@ -49,9 +53,80 @@ public:
     // View methods
     std::string_view view() const noexcept;
     std::span<const uint8_t> span() const noexcept;
-    
+
+    // Instrumentation counters (all zero when built with
+    // HTTP_PARSE_DISABLE_STATS). A regrow is an append that forced the
+    // backing storage to reallocate - frequent regrows mean the initial
+    // capacity or reserve() calls are undersized.
+    struct stats {
+        uint64_t appends = 0;
+        uint64_t bytes_appended = 0;
+        uint64_t regrows = 0;
+    };
+
+    const stats& get_stats() const noexcept { return stats_; }
+    void reset_stats() noexcept { stats_ = {}; }
+
 private:
     std::string buffer_;
+    stats stats_;
+};
+
+// =============================================================================
+// Segmented Output Buffer (Scatter-Gather)
+// =============================================================================
+
+// Rope-style alternative to output_buffer for large responses: bytes are
+// appended into fixed-size blocks drawn from a freelist, so append is O(1)
+// worst case with no realloc+memmove of earlier data, and previously
+// appended bytes never move. The assembled contents are exported as an
+// iovec list for writev/sendmsg instead of one contiguous span.
+class segmented_buffer {
+public:
+    static constexpr size_t block_size = 16 * 1024;
+
+    segmented_buffer() = default;
+
+    // Non-copyable, movable
+    segmented_buffer(const segmented_buffer&) = delete;
+    segmented_buffer& operator=(const segmented_buffer&) = delete;
+    segmented_buffer(segmented_buffer&&) = default;
+    segmented_buffer& operator=(segmented_buffer&&) = default;
+
+    // Append data (same interface as output_buffer)
+    void append(std::string_view data);
+    void append(std::span<const uint8_t> data);
+    void append(const char* data, size_t size);
+    void append_byte(uint8_t byte);
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    // Scatter-gather view over the blocks, one iovec per partially or fully
+    // filled block. Valid until the next append or reset.
+    std::span<const struct iovec> as_iovecs() const;
+
+    // Flatten into a contiguous string (copies; for interop and tests)
+    std::string to_string() const;
+
+    // Recycle all blocks to the freelist for reuse
+    void reset();
+    void clear() { reset(); }
+
+private:
+    struct block {
+        std::unique_ptr<char[]> storage;
+        size_t used = 0;
+    };
+
+    // Tail block with free space, or a fresh one (from the freelist if
+    // possible)
+    block& writable_block();
+
+    std::vector<block> blocks_;
+    std::vector<block> free_blocks_;
+    mutable std::vector<struct iovec> iovecs_;
+    size_t size_ = 0;
 };
 
 } // namespace co::http
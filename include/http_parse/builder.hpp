@@ -1,6 +1,8 @@
 #pragma once
 
 #include "core.hpp"
+#include "buffer.hpp"
+#include <expected>
 #include <unordered_map>
 
 namespace co::http {
@@ -44,9 +46,15 @@ public:
     request_builder& form_body(const std::unordered_map<std::string, std::string>& form_data);
     request_builder& text_body(std::string text);
     
-    request build() const;
+    request build() const &;
+    // Rvalue overload moves the built request out instead of copying
+    request build() &&;
     operator request() const { return build(); }
-    
+
+    // Serializes the wire bytes straight into the buffer, skipping the
+    // intermediate request object and encoder::encode_request entirely
+    std::expected<size_t, error_code> build_into(output_buffer& output) const;
+
 private:
     request req_;
 };
@@ -94,9 +102,15 @@ public:
     response_builder& html_body(std::string html);
     response_builder& text_body(std::string text);
     
-    response build() const;
+    response build() const &;
+    // Rvalue overload moves the built response out instead of copying
+    response build() &&;
     operator response() const { return build(); }
-    
+
+    // Serializes the wire bytes straight into the buffer, skipping the
+    // intermediate response object and encoder::encode_response entirely
+    std::expected<size_t, error_code> build_into(output_buffer& output) const;
+
 private:
     response resp_;
 };
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace co::http {
+
+// =============================================================================
+// Wire Capture Format
+// =============================================================================
+
+// Compact capture format for recording real traffic and replaying it through
+// the library. The layout is an 8-byte magic followed by length-prefixed
+// records back to back:
+//
+//   "HPCAP\0\0\x01"
+//   [uint32_t little-endian payload length][payload bytes] ...
+//
+// One record per read() as the bytes arrived from the socket, so replay
+// reproduces the original read boundaries. The format is position-independent
+// and consumed in place - a reader over a memory-mapped file never copies
+// payload bytes.
+inline constexpr std::uint8_t capture_magic[8] = {'H', 'P', 'C', 'A', 'P', 0, 0, 1};
+
+// Accumulates records in memory; the caller writes data() out to a file
+class capture_writer {
+public:
+    capture_writer() {
+        data_.insert(data_.end(), std::begin(capture_magic), std::end(capture_magic));
+    }
+
+    void add_record(std::span<const uint8_t> payload) {
+        uint32_t length = static_cast<uint32_t>(payload.size());
+        uint8_t prefix[4] = {
+            static_cast<uint8_t>(length & 0xFF),
+            static_cast<uint8_t>((length >> 8) & 0xFF),
+            static_cast<uint8_t>((length >> 16) & 0xFF),
+            static_cast<uint8_t>((length >> 24) & 0xFF),
+        };
+        data_.insert(data_.end(), std::begin(prefix), std::end(prefix));
+        data_.insert(data_.end(), payload.begin(), payload.end());
+        ++record_count_;
+    }
+
+    void add_record(std::string_view payload) {
+        add_record(std::span<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(payload.data()), payload.size()));
+    }
+
+    std::span<const uint8_t> data() const noexcept { return data_; }
+    size_t record_count() const noexcept { return record_count_; }
+
+private:
+    std::vector<uint8_t> data_;
+    size_t record_count_ = 0;
+};
+
+// Walks records over a capture held in memory (typically an mmap'd file);
+// returned spans point into the capture and are never copied
+class capture_reader {
+public:
+    explicit capture_reader(std::span<const uint8_t> capture) : capture_(capture) {
+        valid_ = capture_.size() >= sizeof(capture_magic) &&
+                 std::memcmp(capture_.data(), capture_magic, sizeof(capture_magic)) == 0;
+        pos_ = sizeof(capture_magic);
+    }
+
+    bool valid() const noexcept { return valid_; }
+
+    // Next record, or nullopt at end of capture (or on a truncated record)
+    std::optional<std::span<const uint8_t>> next() noexcept {
+        if (!valid_ || pos_ + 4 > capture_.size()) {
+            return std::nullopt;
+        }
+        uint32_t length = static_cast<uint32_t>(capture_[pos_]) |
+                          (static_cast<uint32_t>(capture_[pos_ + 1]) << 8) |
+                          (static_cast<uint32_t>(capture_[pos_ + 2]) << 16) |
+                          (static_cast<uint32_t>(capture_[pos_ + 3]) << 24);
+        pos_ += 4;
+        if (pos_ + length > capture_.size()) {
+            valid_ = false; // Truncated record
+            return std::nullopt;
+        }
+        auto record = capture_.subspan(pos_, length);
+        pos_ += length;
+        return record;
+    }
+
+    void reset() noexcept {
+        pos_ = sizeof(capture_magic);
+        valid_ = capture_.size() >= sizeof(capture_magic) &&
+                 std::memcmp(capture_.data(), capture_magic, sizeof(capture_magic)) == 0;
+    }
+
+private:
+    std::span<const uint8_t> capture_;
+    size_t pos_ = 0;
+    bool valid_ = false;
+};
+
+} // namespace co::http
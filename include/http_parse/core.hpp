@@ -1,5 +1,7 @@
 #pragma once
 
+#include "detail/small_vector.hpp"
+
 #include <string>
 #include <string_view>
 #include <span>
@@ -116,17 +118,48 @@ struct header {
         : name(std::move(n)), value(std::move(v)), sensitive(s) {}
 };
 
+// Non-owning header representation; name/value point into the caller's buffer
+struct header_view {
+    std::string_view name;
+    std::string_view value;
+
+    header_view() = default;
+    header_view(std::string_view n, std::string_view v) : name(n), value(v) {}
+};
+
+// Header list with inline capacity for the common case; see
+// detail/small_vector.hpp. 16 covers ~95% of real-world header counts, so
+// typical parses never heap-allocate for the list itself.
+using header_list = detail::small_vector<header, 16>;
+using header_view_list = detail::small_vector<header_view, 16>;
+
 // HTTP message base
 struct message {
     version protocol_version = version::http_1_1;
-    std::vector<header> headers;
+    header_list headers;
     std::string body;
-    
+
     std::optional<std::string_view> get_header(std::string_view name) const noexcept;
     void add_header(std::string name, std::string value, bool sensitive = false);
     void set_header(std::string name, std::string value, bool sensitive = false);
     bool has_header(std::string_view name) const noexcept;
     void remove_header(std::string_view name);
+
+private:
+    // Lazy name-hash index for read-mostly messages: middleware chains scan
+    // the same large message dozens of times, so the first lookup on a
+    // message with many headers builds an open-addressing table and later
+    // lookups are O(1). Small messages keep the plain linear scan and the
+    // parse path that never reads headers back pays nothing. The table is
+    // validated against the header storage (data pointer + count) before
+    // use, so direct mutation of `headers` invalidates it implicitly.
+    const header* find_header(std::string_view name) const noexcept;
+    void rebuild_header_index() const;
+    void invalidate_header_index() noexcept { header_index_data_ = nullptr; }
+
+    mutable std::vector<uint32_t> header_index_; // slot -> header offset + 1, 0 = empty
+    mutable const header* header_index_data_ = nullptr;
+    mutable size_t header_index_count_ = 0;
 };
 
 // HTTP request
@@ -140,12 +173,40 @@ struct request : message {
     std::string get_method_string() const;
 };
 
-// HTTP response  
+// HTTP response
 struct response : message {
     unsigned int status_code = 200;
     std::string reason_phrase = "OK";
 };
 
+// =============================================================================
+// Zero-Copy View Types
+// =============================================================================
+
+// Non-owning HTTP message base. All views reference the input buffer passed to
+// the parser; the buffer must outlive the view. Header names keep their
+// original case, so lookups are case-insensitive.
+struct message_view {
+    version protocol_version = version::http_1_1;
+    header_view_list headers;
+    std::string_view body;
+
+    std::optional<std::string_view> get_header(std::string_view name) const noexcept;
+    bool has_header(std::string_view name) const noexcept;
+};
+
+// Non-owning HTTP request
+struct request_view : message_view {
+    method method_type = method::get;
+    std::string_view uri;
+};
+
+// Non-owning HTTP response
+struct response_view : message_view {
+    unsigned int status_code = 200;
+    std::string_view reason_phrase;
+};
+
 } // namespace co::http
 
 // Include implementation
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "core.hpp"
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace co::http {
+
+// =============================================================================
+// Coroutine Task for Async Parsing
+// =============================================================================
+
+// Minimal lazy task returned by the async parsing interface. The coroutine
+// does not run until the task is awaited (or resumed manually), completion
+// resumes the awaiter by symmetric transfer, and the only allocation is the
+// coroutine frame itself - suspensions allocate nothing.
+template <typename T>
+class parse_task {
+public:
+    struct promise_type {
+        std::optional<T> value_;
+        std::exception_ptr exception_;
+        std::coroutine_handle<> continuation_;
+
+        parse_task get_return_object() {
+            return parse_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct final_awaiter {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) const noexcept {
+                auto continuation = h.promise().continuation_;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+            void await_resume() const noexcept {}
+        };
+        final_awaiter final_suspend() noexcept { return {}; }
+
+        void return_value(T value) { value_.emplace(std::move(value)); }
+        void unhandled_exception() { exception_ = std::current_exception(); }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    parse_task() = default;
+    explicit parse_task(handle_type handle) : handle_(handle) {}
+    ~parse_task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Move-only: the task owns the coroutine frame
+    parse_task(const parse_task&) = delete;
+    parse_task& operator=(const parse_task&) = delete;
+    parse_task(parse_task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    parse_task& operator=(parse_task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    // Awaiting the task starts it and resumes the awaiter on completion
+    bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle_.promise().continuation_ = continuation;
+        return handle_;
+    }
+    T await_resume() { return take(); }
+
+    // Manual driving for event loops without an outer coroutine: resume()
+    // runs until the task suspends on its reader or finishes
+    void resume() { handle_.resume(); }
+    bool done() const noexcept { return !handle_ || handle_.done(); }
+    T result() { return take(); }
+
+private:
+    T take() {
+        if (handle_.promise().exception_) {
+            std::rethrow_exception(handle_.promise().exception_);
+        }
+        return std::move(*handle_.promise().value_);
+    }
+
+    handle_type handle_;
+};
+
+} // namespace co::http
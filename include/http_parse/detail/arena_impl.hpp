@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../arena.hpp"
+#include <cstring>
+
+namespace co::http {
+
+// =============================================================================
+// Message Arena Implementation
+// =============================================================================
+
+inline message_arena::message_arena(size_t block_size)
+    : block_size_(block_size) {}
+
+inline void message_arena::add_block(size_t min_size) {
+    size_t capacity = block_size_;
+    if (min_size > capacity) {
+        capacity = min_size;
+    }
+    block b;
+    b.data = std::make_unique<char[]>(capacity);
+    b.capacity = capacity;
+    blocks_.push_back(std::move(b));
+}
+
+inline char* message_arena::allocate(size_t size) {
+    if (blocks_.empty() || blocks_.back().used + size > blocks_.back().capacity) {
+        add_block(size);
+    }
+    block& b = blocks_.back();
+    char* ptr = b.data.get() + b.used;
+    b.used += size;
+    bytes_used_ += size;
+    return ptr;
+}
+
+inline std::string_view message_arena::copy(std::string_view data) {
+    if (data.empty()) {
+        return {};
+    }
+    char* ptr = allocate(data.size());
+    std::memcpy(ptr, data.data(), data.size());
+    return {ptr, data.size()};
+}
+
+inline void message_arena::reset() noexcept {
+    // Keep only the first block so a warm connection stops allocating
+    if (blocks_.size() > 1) {
+        blocks_.erase(blocks_.begin() + 1, blocks_.end());
+    }
+    if (!blocks_.empty()) {
+        blocks_.front().used = 0;
+    }
+    bytes_used_ = 0;
+}
+
+inline size_t message_arena::bytes_used() const noexcept {
+    return bytes_used_;
+}
+
+} // namespace co::http
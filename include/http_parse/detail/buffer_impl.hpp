@@ -14,19 +14,31 @@ inline output_buffer::output_buffer(size_t initial_capacity) {
 }
 
 inline void output_buffer::append(std::string_view data) {
-    buffer_.append(data);
+    append(data.data(), data.size());
 }
 
 inline void output_buffer::append(std::span<const uint8_t> data) {
-    buffer_.append(reinterpret_cast<const char*>(data.data()), data.size());
+    append(reinterpret_cast<const char*>(data.data()), data.size());
 }
 
 inline void output_buffer::append(const char* data, size_t size) {
+    const size_t old_capacity = buffer_.capacity();
     buffer_.append(data, size);
+    detail::stats_add(stats_.appends);
+    detail::stats_add(stats_.bytes_appended, size);
+    if (buffer_.capacity() != old_capacity) {
+        detail::stats_add(stats_.regrows);
+    }
 }
 
 inline void output_buffer::append_byte(uint8_t byte) {
+    const size_t old_capacity = buffer_.capacity();
     buffer_.push_back(static_cast<char>(byte));
+    detail::stats_add(stats_.appends);
+    detail::stats_add(stats_.bytes_appended, 1);
+    if (buffer_.capacity() != old_capacity) {
+        detail::stats_add(stats_.regrows);
+    }
 }
 
 inline void output_buffer::reserve(size_t capacity) {
@@ -70,9 +82,79 @@ inline std::string_view output_buffer::view() const noexcept {
 
 inline std::span<const uint8_t> output_buffer::span() const noexcept {
     return std::span<const uint8_t>{
-        reinterpret_cast<const uint8_t*>(buffer_.data()), 
+        reinterpret_cast<const uint8_t*>(buffer_.data()),
         buffer_.size()
     };
 }
 
+// =============================================================================
+// Segmented Buffer Implementation
+// =============================================================================
+
+inline segmented_buffer::block& segmented_buffer::writable_block() {
+    if (blocks_.empty() || blocks_.back().used == block_size) {
+        if (!free_blocks_.empty()) {
+            blocks_.push_back(std::move(free_blocks_.back()));
+            free_blocks_.pop_back();
+        } else {
+            blocks_.push_back(block{std::make_unique<char[]>(block_size), 0});
+        }
+    }
+    return blocks_.back();
+}
+
+inline void segmented_buffer::append(const char* data, size_t size) {
+    while (size > 0) {
+        block& tail = writable_block();
+        size_t take = std::min(size, block_size - tail.used);
+        std::copy(data, data + take, tail.storage.get() + tail.used);
+        tail.used += take;
+        data += take;
+        size -= take;
+        size_ += take;
+    }
+}
+
+inline void segmented_buffer::append(std::string_view data) {
+    append(data.data(), data.size());
+}
+
+inline void segmented_buffer::append(std::span<const uint8_t> data) {
+    append(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+inline void segmented_buffer::append_byte(uint8_t byte) {
+    block& tail = writable_block();
+    tail.storage[tail.used++] = static_cast<char>(byte);
+    ++size_;
+}
+
+inline std::span<const struct iovec> segmented_buffer::as_iovecs() const {
+    iovecs_.clear();
+    iovecs_.reserve(blocks_.size());
+    for (const block& b : blocks_) {
+        iovecs_.push_back({b.storage.get(), b.used});
+    }
+    return {iovecs_.data(), iovecs_.size()};
+}
+
+inline std::string segmented_buffer::to_string() const {
+    std::string result;
+    result.reserve(size_);
+    for (const block& b : blocks_) {
+        result.append(b.storage.get(), b.used);
+    }
+    return result;
+}
+
+inline void segmented_buffer::reset() {
+    for (block& b : blocks_) {
+        b.used = 0;
+        free_blocks_.push_back(std::move(b));
+    }
+    blocks_.clear();
+    iovecs_.clear();
+    size_ = 0;
+}
+
 } // namespace co::http
\ No newline at end of file
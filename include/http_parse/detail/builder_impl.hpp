@@ -2,7 +2,10 @@
 
 #include "../builder.hpp"
 #include "../core.hpp"
+#include "../encoder.hpp"
+#include "scan.hpp"
 #include <sstream>
+#include <utility>
 
 namespace co::http {
 
@@ -132,10 +135,70 @@ inline request_builder& request_builder::text_body(std::string text) {
     return content_type("text/plain").body(std::move(text));
 }
 
-inline request request_builder::build() const {
+inline request request_builder::build() const & {
     return req_;
 }
 
+inline request request_builder::build() && {
+    return std::move(req_);
+}
+
+namespace detail {
+
+// Shared tail of the HTTP/1.x wire form: headers, optional Date stamp,
+// auto Content-Length, blank line and body - written without any
+// intermediate string
+inline void append_http1_tail(const message& msg, output_buffer& output, bool stamp_date) {
+    for (const auto& h : msg.headers) {
+        output.append(h.name);
+        output.append(": ", 2);
+        output.append(h.value);
+        output.append("\r\n", 2);
+    }
+
+    if (stamp_date && !msg.has_header("date")) {
+        output.append("Date: ", 6);
+        output.append(encoder::cached_date());
+        output.append("\r\n", 2);
+    }
+
+    if (!msg.body.empty() && !msg.has_header("content-length")) {
+        char digits[20];
+        char* end = detail::format_decimal(digits, msg.body.size());
+        output.append("Content-Length: ", 16);
+        output.append(digits, static_cast<size_t>(end - digits));
+        output.append("\r\n", 2);
+    }
+
+    output.append("\r\n", 2);
+
+    if (!msg.body.empty()) {
+        output.append(msg.body);
+    }
+}
+
+} // namespace detail
+
+inline std::expected<size_t, error_code> request_builder::build_into(output_buffer& output) const {
+    try {
+        size_t initial_size = output.size();
+
+        // Request line
+        output.append(req_.get_method_string());
+        output.append(" ", 1);
+        output.append(req_.uri);
+        switch (req_.protocol_version) {
+            case version::http_1_0: output.append(" HTTP/1.0\r\n", 11); break;
+            default:                output.append(" HTTP/1.1\r\n", 11); break;
+        }
+
+        detail::append_http1_tail(req_, output, false);
+        return output.size() - initial_size;
+    } catch (...) {
+        return std::unexpected(error_code::protocol_error);
+    }
+}
+
 // =============================================================================
 // Response Builder Implementation
 // =============================================================================
@@ -315,8 +378,36 @@ inline response_builder& response_builder::text_body(std::string text) {
     return content_type("text/plain").body(std::move(text));
 }
 
-inline response response_builder::build() const {
+inline response response_builder::build() const & {
     return resp_;
 }
 
+inline response response_builder::build() && {
+    return std::move(resp_);
+}
+
+inline std::expected<size_t, error_code> response_builder::build_into(output_buffer& output) const {
+    try {
+        size_t initial_size = output.size();
+
+        // Status line
+        switch (resp_.protocol_version) {
+            case version::http_1_0: output.append("HTTP/1.0 ", 9); break;
+            default:                output.append("HTTP/1.1 ", 9); break;
+        }
+        char digits[20];
+        char* end = detail::format_decimal(digits, resp_.status_code);
+        output.append(digits, static_cast<size_t>(end - digits));
+        output.append(" ", 1);
+        output.append(resp_.reason_phrase);
+        output.append("\r\n", 2);
+
+        // Responses get the cached Date stamped, matching encode_response
+        detail::append_http1_tail(resp_, output, true);
+        return output.size() - initial_size;
+    } catch (...) {
+        return std::unexpected(error_code::protocol_error);
+    }
+}
+
 } // namespace co::http
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../core.hpp"
+#include "scan.hpp"
+#include "token_tables.hpp"
 #include <algorithm>
 #include <cctype>
 
@@ -10,25 +12,76 @@ namespace co::http {
 // Message Implementation
 // =============================================================================
 
+// Headers past this count get the hash index; below it the linear scan is
+// cheaper than building the table
+inline constexpr size_t header_index_threshold = 8;
+
+inline void message::rebuild_header_index() const {
+  size_t capacity = 16;
+  while (capacity < headers.size() * 2) {
+    capacity *= 2;
+  }
+  header_index_.assign(capacity, 0);
+  const size_t mask = capacity - 1;
+  for (uint32_t i = 0; i < headers.size(); ++i) {
+    size_t slot = detail::iname_hash(headers[i].name) & mask;
+    while (header_index_[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    header_index_[slot] = i + 1;
+  }
+  header_index_data_ = headers.data();
+  header_index_count_ = headers.size();
+}
+
+inline const header *
+message::find_header(std::string_view name) const noexcept {
+  if (headers.size() <= header_index_threshold) {
+    auto it =
+        std::find_if(headers.begin(), headers.end(), [name](const header &h) {
+          return detail::iequals_ascii(name, h.name);
+        });
+    return it != headers.end() ? &*it : nullptr;
+  }
+
+  if (header_index_data_ != headers.data() ||
+      header_index_count_ != headers.size()) {
+    rebuild_header_index();
+  }
+
+  // Linear probing visits headers in insertion order within a chain, so a
+  // duplicated name still resolves to its first occurrence
+  const size_t mask = header_index_.size() - 1;
+  size_t slot = detail::iname_hash(name) & mask;
+  while (uint32_t entry = header_index_[slot]) {
+    const header &h = headers[entry - 1];
+    if (detail::iequals_ascii(name, h.name)) {
+      return &h;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return nullptr;
+}
+
 inline std::optional<std::string_view>
 message::get_header(std::string_view name) const noexcept {
-  auto it =
-      std::find_if(headers.begin(), headers.end(), [name](const header &h) {
-        return std::equal(
-            name.begin(), name.end(), h.name.begin(), h.name.end(),
-            [](char a, char b) { return std::tolower(a) == std::tolower(b); });
-      });
-
-  if (it != headers.end()) {
-    return std::string_view{it->value};
+  if (const header *h = find_header(name)) {
+    return std::string_view{h->value};
   }
   return std::nullopt;
 }
 
 inline void message::add_header(std::string name, std::string value,
                                 bool sensitive) {
-  std::transform(name.begin(), name.end(), name.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
+  invalidate_header_index();
+  // Common names resolve through the compile-time table instead of a
+  // per-character tolower pass
+  if (auto canonical = detail::common_header_name(name)) {
+    name.assign(*canonical);
+  } else {
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+  }
   headers.emplace_back(std::move(name), std::move(value), sensitive);
 }
 
@@ -38,9 +91,7 @@ inline void message::set_header(std::string name, std::string value,
                  [](unsigned char c) { return std::tolower(c); });
   auto it =
       std::find_if(headers.begin(), headers.end(), [&name](const header &h) {
-        return std::equal(
-            name.begin(), name.end(), h.name.begin(), h.name.end(),
-            [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+        return detail::iequals_ascii(name, h.name);
       });
 
   if (it != headers.end()) {
@@ -56,43 +107,50 @@ inline bool message::has_header(std::string_view name) const noexcept {
 }
 
 inline void message::remove_header(std::string_view name) {
+  invalidate_header_index();
   headers.erase(std::remove_if(headers.begin(), headers.end(),
                                [name](const header &h) {
-                                 return std::equal(name.begin(), name.end(),
-                                                   h.name.begin(), h.name.end(),
-                                                   [](char a, char b) {
-                                                     return std::tolower(a) ==
-                                                            std::tolower(b);
-                                                   });
+                                 return detail::iequals_ascii(name, h.name);
                                }),
                 headers.end());
 }
 
+// =============================================================================
+// Message View Implementation
+// =============================================================================
+
+inline std::optional<std::string_view>
+message_view::get_header(std::string_view name) const noexcept {
+  auto it =
+      std::find_if(headers.begin(), headers.end(), [name](const header_view &h) {
+        // Interned names (see detail/intern.hpp) match on identity without
+        // touching the bytes
+        if (h.name.data() == name.data() && h.name.size() == name.size()) {
+          return true;
+        }
+        return detail::iequals_ascii(name, h.name);
+      });
+
+  if (it != headers.end()) {
+    return it->value;
+  }
+  return std::nullopt;
+}
+
+inline bool message_view::has_header(std::string_view name) const noexcept {
+  return get_header(name).has_value();
+}
+
 // =============================================================================
 // Request Implementation
 // =============================================================================
 
+inline method method_from_string(std::string_view m) {
+  return detail::method_from_token(m);
+}
+
 inline void request::set_method(std::string_view m) {
-  if (m == "GET")
-    method_type = method::get;
-  else if (m == "POST")
-    method_type = method::post;
-  else if (m == "PUT")
-    method_type = method::put;
-  else if (m == "DELETE")
-    method_type = method::delete_;
-  else if (m == "HEAD")
-    method_type = method::head;
-  else if (m == "OPTIONS")
-    method_type = method::options;
-  else if (m == "TRACE")
-    method_type = method::trace;
-  else if (m == "CONNECT")
-    method_type = method::connect;
-  else if (m == "PATCH")
-    method_type = method::patch;
-  else
-    method_type = method::unknown;
+  method_type = method_from_string(m);
 }
 
 inline std::string request::get_method_string() const {
@@ -3,8 +3,12 @@
 #include "../encoder.hpp"
 #include "../core.hpp"
 #include "hpack_impl.hpp"
+#include "scan.hpp"
 #include <sstream>
 #include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <ctime>
 #include <iomanip>
 
 namespace co::http {
@@ -49,6 +53,34 @@ inline encoder& encoder::operator=(encoder&&) noexcept = default;
 
 namespace detail {
 
+// Locale-independent IMF-fixdate formatting (RFC 7231 Section 7.1.1.1);
+// writes exactly 29 characters, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+inline void format_imf_fixdate(const std::tm& tm, char* out) {
+    static constexpr char day_names[] = "SunMonTueWedThuFriSat";
+    static constexpr char month_names[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    auto write2 = [](char* p, int v) {
+        p[0] = static_cast<char>('0' + v / 10);
+        p[1] = static_cast<char>('0' + v % 10);
+    };
+    std::memcpy(out, day_names + tm.tm_wday * 3, 3);
+    out[3] = ',';
+    out[4] = ' ';
+    write2(out + 5, tm.tm_mday);
+    out[7] = ' ';
+    std::memcpy(out + 8, month_names + tm.tm_mon * 3, 3);
+    out[11] = ' ';
+    int year = tm.tm_year + 1900;
+    write2(out + 12, year / 100);
+    write2(out + 14, year % 100);
+    out[16] = ' ';
+    write2(out + 17, tm.tm_hour);
+    out[19] = ':';
+    write2(out + 20, tm.tm_min);
+    out[22] = ':';
+    write2(out + 23, tm.tm_sec);
+    std::memcpy(out + 25, " GMT", 4);
+}
+
 inline std::string encode_http1_request(const request& req) {
     std::ostringstream oss;
     
@@ -68,7 +100,10 @@ inline std::string encode_http1_request(const request& req) {
     
     // Add content-length if body exists and not already set
     if (!req.body.empty() && !req.has_header("content-length")) {
-        oss << "Content-Length: " << req.body.size() << "\r\n";
+        char digits[20];
+        oss << "Content-Length: ";
+        oss.write(digits, format_decimal(digits, req.body.size()) - digits);
+        oss << "\r\n";
     }
     
     // End headers
@@ -91,16 +126,27 @@ inline std::string encode_http1_response(const response& resp) {
         case version::http_1_1: oss << "HTTP/1.1"; break;
         default: oss << "HTTP/1.1"; break;
     }
-    oss << " " << resp.status_code << " " << resp.reason_phrase << "\r\n";
+    char digits[20];
+    oss << ' ';
+    oss.write(digits, format_decimal(digits, resp.status_code) - digits);
+    oss << ' ' << resp.reason_phrase << "\r\n";
     
     // Headers
     for (const auto& header : resp.headers) {
         oss << header.name << ": " << header.value << "\r\n";
     }
-    
+
+    // Responses should carry a Date header (RFC 7231 Section 7.1.1.2);
+    // stamp the cached value when the message lacks one
+    if (!resp.has_header("date")) {
+        oss << "Date: " << encoder::cached_date() << "\r\n";
+    }
+
     // Add content-length if body exists and not already set
     if (!resp.body.empty() && !resp.has_header("content-length")) {
-        oss << "Content-Length: " << resp.body.size() << "\r\n";
+        oss << "Content-Length: ";
+        oss.write(digits, format_decimal(digits, resp.body.size()) - digits);
+        oss << "\r\n";
     }
     
     // End headers
@@ -128,6 +174,92 @@ inline size_t encode_http1_response_to_buffer(const response& resp, output_buffe
     return size;
 }
 
+} // namespace detail
+
+// =============================================================================
+// Response Template Implementation
+// =============================================================================
+
+inline response_template::response_template(const response& skeleton) {
+    // Status line
+    switch (skeleton.protocol_version) {
+        case version::http_1_0: head_.append("HTTP/1.0"); break;
+        case version::http_1_1: head_.append("HTTP/1.1"); break;
+        default: head_.append("HTTP/1.1"); break;
+    }
+    head_.push_back(' ');
+    char digits[20];
+    head_.append(digits, static_cast<size_t>(detail::format_decimal(digits, skeleton.status_code) - digits));
+    head_.push_back(' ');
+    head_.append(skeleton.reason_phrase);
+    head_.append("\r\n");
+
+    // Fixed headers; Content-Length is always stamped at encode time
+    for (const auto& header : skeleton.headers) {
+        auto canonical = detail::common_header_name(header.name);
+        if (canonical && *canonical == "content-length") {
+            continue;
+        }
+        head_.append(header.name);
+        head_.append(": ");
+        head_.append(header.value);
+        head_.append("\r\n");
+    }
+
+    // Without a literal Date on the skeleton, reserve a slot that encoding
+    // fills from encoder::cached_date()
+    date_slot_ = !skeleton.has_header("date");
+    if (date_slot_) {
+        head_.append("Date: ");
+        mid_.append("\r\nContent-Length: ");
+    } else {
+        head_.append("Content-Length: ");
+    }
+}
+
+inline std::expected<size_t, error_code> encoder::encode_from_template(const response_template& tmpl,
+                                                                       std::string_view body, output_buffer& output) {
+    try {
+        size_t initial_size = output.size();
+
+        output.append(tmpl.head_);
+        if (tmpl.date_slot_) {
+            output.append(cached_date());
+            output.append(tmpl.mid_);
+        }
+
+        char digits[20];
+        char* end = detail::format_decimal(digits, body.size());
+        output.append(digits, static_cast<size_t>(end - digits));
+        output.append("\r\n\r\n", 4);
+
+        if (!body.empty()) {
+            output.append(body);
+        }
+
+        return output.size() - initial_size;
+    } catch (...) {
+        return std::unexpected(error_code::protocol_error);
+    }
+}
+
+inline std::string_view encoder::cached_date() {
+    // 每线程缓存：同一秒内重复调用直接命中，避免反复走gmtime/格式化
+    thread_local std::time_t cached_second = 0;
+    thread_local char formatted[30];
+
+    std::time_t now = std::time(nullptr);
+    if (now != cached_second) {
+        std::tm tm_utc{};
+        gmtime_r(&now, &tm_utc);
+        detail::format_imf_fixdate(tm_utc, formatted);
+        cached_second = now;
+    }
+    return std::string_view(formatted, 29);
+}
+
+namespace detail {
+
 // =============================================================================
 // HTTP/2 Frame Encoding Utilities
 // =============================================================================
@@ -249,6 +381,90 @@ inline size_t encode_h2_preface(output_buffer& output) {
 
 } // namespace detail
 
+// =============================================================================
+// Streaming Body Framing Implementation
+// =============================================================================
+
+inline body_stream body_stream::chunked() noexcept {
+    return body_stream(framing_mode::chunked);
+}
+
+inline body_stream body_stream::content_length(uint64_t total) noexcept {
+    body_stream stream(framing_mode::content_length);
+    stream.remaining_ = total;
+    return stream;
+}
+
+inline body_stream body_stream::h2_data(uint32_t stream_id, uint32_t max_frame_size) noexcept {
+    body_stream stream(framing_mode::h2_data);
+    stream.stream_id_ = stream_id;
+    stream.max_frame_size_ = max_frame_size;
+    return stream;
+}
+
+inline body_stream::frame body_stream::next(uint64_t available) noexcept {
+    frame result;
+    if (finished_ || available == 0) {
+        return result;
+    }
+
+    switch (mode_) {
+        case framing_mode::chunked: {
+            // 块大小行复用固定缓冲区，下一次调用前有效
+            char* end = detail::format_hex(framing_, available);
+            *end++ = '\r';
+            *end++ = '\n';
+            result.prefix = std::string_view(framing_, static_cast<size_t>(end - framing_));
+            result.payload = static_cast<size_t>(available);
+            result.suffix = std::string_view("\r\n", 2);
+            break;
+        }
+        case framing_mode::content_length: {
+            result.payload = static_cast<size_t>(std::min(available, remaining_));
+            remaining_ -= result.payload;
+            break;
+        }
+        case framing_mode::h2_data: {
+            uint32_t length = static_cast<uint32_t>(
+                std::min<uint64_t>(available, max_frame_size_));
+            auto* header = reinterpret_cast<uint8_t*>(framing_);
+            detail::write_uint24_be(header, length);
+            header[3] = 0x00; // DATA frame
+            header[4] = 0x00;
+            detail::write_uint32_be(header + 5, stream_id_ & 0x7FFFFFFF);
+            result.prefix = std::string_view(framing_, 9);
+            result.payload = length;
+            break;
+        }
+    }
+
+    framed_ += result.payload;
+    return result;
+}
+
+inline std::string_view body_stream::finish() noexcept {
+    if (finished_) {
+        return {};
+    }
+    finished_ = true;
+
+    switch (mode_) {
+        case framing_mode::chunked:
+            return std::string_view("0\r\n\r\n", 5);
+        case framing_mode::content_length:
+            return {};
+        case framing_mode::h2_data: {
+            auto* header = reinterpret_cast<uint8_t*>(framing_);
+            detail::write_uint24_be(header, 0);
+            header[3] = 0x00; // DATA frame
+            header[4] = 0x01; // END_STREAM
+            detail::write_uint32_be(header + 5, stream_id_ & 0x7FFFFFFF);
+            return std::string_view(framing_, 9);
+        }
+    }
+    return {};
+}
+
 // =============================================================================
 // HTTP/1.x Encoding Interface Implementation
 // =============================================================================
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace co::http::detail {
+
+// =============================================================================
+// Compile-Time String Literal Carrier
+// =============================================================================
+
+// Structural type so string literals can travel as non-type template
+// parameters, e.g. parse_request_select<"host", "x-route-key">(data). The
+// trailing NUL of the literal is carried but excluded from view().
+template <std::size_t N>
+struct fixed_string {
+    char value[N]{};
+
+    constexpr fixed_string(const char (&str)[N]) noexcept {
+        for (std::size_t i = 0; i < N; ++i) {
+            value[i] = str[i];
+        }
+    }
+
+    constexpr std::string_view view() const noexcept {
+        return std::string_view{value, N - 1};
+    }
+};
+
+} // namespace co::http::detail
@@ -2,9 +2,12 @@
 
 #include "../core.hpp"
 #include "../buffer.hpp"
+#include "huffman.hpp"
+#include "stats.hpp"
 #include <unordered_map>
 #include <array>
 #include <bitset>
+#include <memory>
 
 namespace co::http::detail {
 
@@ -12,33 +15,197 @@ namespace co::http::detail {
 // HPACK Implementation (RFC 7541)
 // =============================================================================
 
+// Transparent hash so index maps can be probed with string_view keys built in
+// a reused buffer, without allocating per lookup
+struct transparent_string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const noexcept {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+using header_index_map =
+    std::unordered_map<std::string, uint64_t, transparent_string_hash, std::equal_to<>>;
+
+// Builds the "name\0value" composite key used by the exact-match indexes
+inline void make_exact_key(std::string& key, std::string_view name, std::string_view value) {
+    key.clear();
+    key.reserve(name.size() + value.size() + 1);
+    key.append(name);
+    key.push_back('\0');
+    key.append(value);
+}
+
+// =============================================================================
+// HPACK Dynamic Table (RFC 7541 Section 2.3.2)
+// =============================================================================
+
+// Fixed-capacity ring buffer of entry descriptors over a contiguous character
+// arena, so insertion and eviction are O(1) with no per-entry heap traffic.
+// The arena holds twice the table's maximum accounted size: an entry that
+// would straddle the wrap point skips to the front instead, and the 32-byte
+// accounting overhead per entry guarantees the skipped slack always fits.
+class hpack_dynamic_table {
+public:
+    explicit hpack_dynamic_table(uint32_t max_size = 4096);
+
+    // Accounted size per RFC 7541 Section 4.1 (name + value + 32 per entry)
+    size_t size() const noexcept { return accounted_size_; }
+    size_t count() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    uint32_t max_size() const noexcept { return max_size_; }
+
+    // Entry 0 is the most recent insertion (HPACK dynamic index 1). Views are
+    // valid until the entry is evicted.
+    std::pair<std::string_view, std::string_view> at(size_t index) const noexcept;
+
+    // The caller must evict first so the entry fits (accounted size within
+    // max_size()); `seq` is an opaque tag the encoder uses for its hash index
+    void push_front(std::string_view name, std::string_view value, uint64_t seq = 0);
+
+    // Oldest entry, next in line for eviction
+    std::pair<std::string_view, std::string_view> back() const noexcept;
+    uint64_t back_seq() const noexcept;
+    void pop_back();
+
+    // Rebuilds the backing storage for the new maximum; the caller is
+    // responsible for evicting down to `max_size` first (it may need to
+    // unindex the victims)
+    void set_max_size(uint32_t max_size);
+    void clear();
+
+private:
+    struct entry_ref {
+        uint32_t offset;
+        uint32_t name_len;
+        uint32_t value_len;
+        uint64_t seq;
+        size_t size() const noexcept { return name_len + value_len + 32; }
+    };
+
+    const entry_ref& ref_at(size_t logical) const noexcept {
+        // logical 0 = newest; descriptors live oldest-first from head_
+        return ring_[(head_ + count_ - 1 - logical) % ring_cap_];
+    }
+
+    uint32_t max_size_ = 4096;
+    std::unique_ptr<char[]> arena_;
+    size_t arena_cap_ = 0;
+    size_t write_off_ = 0;  // One past the newest entry's characters
+
+    std::unique_ptr<entry_ref[]> ring_;
+    size_t ring_cap_ = 0;
+    size_t head_ = 0;       // Descriptor slot of the oldest entry
+    size_t count_ = 0;
+    size_t accounted_size_ = 0;
+};
+
 class hpack_encoder {
 public:
     hpack_encoder() = default;
     
     // Encode headers using HPACK
     std::expected<size_t, error_code> encode_headers(const std::vector<header>& headers, output_buffer& output);
-    
+
+    // Indexed-vs-literal strategy. Compression state costs CPU: incremental
+    // indexing maintains the dynamic table and its hash indexes, and Huffman
+    // coding touches every literal byte. Which side of that trade is right
+    // depends on the link, so the strategy is selectable per encoder:
+    //  - throughput: static-table hits only where they are free; everything
+    //    else goes out as a raw literal without indexing, no Huffman, no
+    //    dynamic-table maintenance. For links where CPU is scarcer than
+    //    bandwidth.
+    //  - ratio: index every non-sensitive literal and Huffman-code literals
+    //    (the historical default) - repeated header mixes compress to a few
+    //    bytes each after warmup.
+    //  - adaptive: runs as ratio, but samples the dynamic-table hit rate
+    //    over windows of recent headers; when indexing stops paying for
+    //    itself the encoder drops to throughput behavior, and periodically
+    //    re-probes a window with indexing on so it can recover when the
+    //    traffic becomes repetitive again.
+    // All three emit valid HPACK - the decoder needs no configuration.
+    enum class indexing_policy : uint8_t {
+        throughput,
+        ratio,
+        adaptive,
+    };
+
+    void set_indexing_policy(indexing_policy policy) noexcept {
+        policy_ = policy;
+        adaptive_literal_mode_ = false;
+        adaptive_probing_ = false;
+        probe_window_countdown_ = 0;
+        window_headers_ = 0;
+        window_dynamic_hits_ = 0;
+    }
+    indexing_policy get_indexing_policy() const noexcept { return policy_; }
+
+    // The mode adaptive is currently running in (ratio or throughput);
+    // equal to get_indexing_policy() for the fixed policies
+    indexing_policy effective_policy() const noexcept {
+        if (policy_ != indexing_policy::adaptive) {
+            return policy_;
+        }
+        return (adaptive_literal_mode_ && !adaptive_probing_) ? indexing_policy::throughput
+                                                              : indexing_policy::ratio;
+    }
+
     // Configuration
     void set_dynamic_table_size(uint32_t size);
-    uint32_t get_dynamic_table_size() const noexcept { return dynamic_table_size_; }
-    
+    uint32_t get_dynamic_table_size() const noexcept { return dynamic_table_.max_size(); }
+
     void clear_dynamic_table();
-    
+
+    // Instrumentation counters (all zero when built with
+    // HTTP_PARSE_DISABLE_STATS). static_hits/dynamic_hits/literal_headers
+    // partition the headers seen by encode_headers, so their ratios show how
+    // well the tables match the traffic. huffman_bytes_in is raw characters
+    // fed to the Huffman coder, huffman_bytes_out the encoded bytes emitted.
+    struct stats {
+        uint64_t headers_encoded = 0;
+        uint64_t static_hits = 0;
+        uint64_t dynamic_hits = 0;
+        uint64_t literal_headers = 0;
+        uint64_t huffman_bytes_in = 0;
+        uint64_t huffman_bytes_out = 0;
+    };
+
+    const stats& get_stats() const noexcept { return stats_; }
+    void reset_stats() noexcept { stats_ = {}; }
+
     // Static table (RFC 7541 Appendix B) - public for sharing with decoder
     static const std::array<std::pair<std::string_view, std::string_view>, 61> static_table_;
-    
+
 private:
-    struct dynamic_entry {
-        std::string name;
-        std::string value;
-        size_t size() const { return name.size() + value.size() + 32; } // RFC 7541 Section 4.1
-    };
-    
-    uint32_t dynamic_table_size_ = 4096;
-    std::vector<dynamic_entry> dynamic_table_;
-    size_t dynamic_table_current_size_ = 0;
-    
+    hpack_dynamic_table dynamic_table_;
+    stats stats_;
+
+    // Incremental hash index over dynamic_table_, maintained on insert/evict.
+    // Entries map to insertion sequence numbers; the current HPACK index is
+    // recovered from the distance to the newest sequence number.
+    uint64_t insert_seq_ = 0;
+    header_index_map dynamic_exact_index_;
+    header_index_map dynamic_name_index_;
+
+    // Indexing policy and adaptive sampling state. Hit rates are sampled
+    // over fixed windows of headers; after a cold window the adaptive mode
+    // drops to literal-only encoding, then re-probes with indexing on every
+    // few windows to detect when the traffic has become repetitive.
+    static constexpr uint32_t adaptive_window_ = 256;
+    static constexpr uint32_t adaptive_probe_interval_ = 4;
+
+    indexing_policy policy_ = indexing_policy::ratio;
+    bool adaptive_literal_mode_ = false;
+    bool adaptive_probing_ = false;
+    bool huffman_enabled_ = true;
+    uint32_t probe_window_countdown_ = 0;
+    uint32_t window_headers_ = 0;
+    uint32_t window_dynamic_hits_ = 0;
+
+    // Advances the sampling window and flips the adaptive mode at window
+    // boundaries
+    void adaptive_note(bool dynamic_hit);
+
     // Encoding methods
     size_t encode_indexed_header(size_t index, output_buffer& output);
     size_t encode_literal_header_with_indexing(std::string_view name, std::string_view value, output_buffer& output);
@@ -66,21 +233,29 @@ public:
     
     // Configuration
     void set_dynamic_table_size(uint32_t size);
-    uint32_t get_dynamic_table_size() const noexcept { return dynamic_table_size_; }
-    
+    uint32_t get_dynamic_table_size() const noexcept { return dynamic_table_.max_size(); }
+
     void clear_dynamic_table();
-    
-private:
-    struct dynamic_entry {
-        std::string name;
-        std::string value;
-        size_t size() const { return name.size() + value.size() + 32; }
+
+    // Instrumentation counters, mirroring hpack_encoder::stats for the
+    // decode direction. huffman_bytes_in is encoded bytes consumed,
+    // huffman_bytes_out the decoded characters produced.
+    struct stats {
+        uint64_t headers_decoded = 0;
+        uint64_t static_hits = 0;
+        uint64_t dynamic_hits = 0;
+        uint64_t literal_headers = 0;
+        uint64_t huffman_bytes_in = 0;
+        uint64_t huffman_bytes_out = 0;
     };
-    
-    uint32_t dynamic_table_size_ = 4096;
-    std::vector<dynamic_entry> dynamic_table_;
-    size_t dynamic_table_current_size_ = 0;
-    
+
+    const stats& get_stats() const noexcept { return stats_; }
+    void reset_stats() noexcept { stats_ = {}; }
+
+private:
+    hpack_dynamic_table dynamic_table_;
+    stats stats_;
+
     // Static table (same as encoder)
     static const std::array<std::pair<std::string_view, std::string_view>, 61> static_table_;
     
@@ -170,70 +345,6 @@ inline const std::array<std::pair<std::string_view, std::string_view>, 61> hpack
 
 inline const std::array<std::pair<std::string_view, std::string_view>, 61> hpack_decoder::static_table_ = hpack_encoder::static_table_;
 
-// =============================================================================
-// Huffman Encoding Tables (RFC 7541 Appendix B)
-// =============================================================================
-
-struct huffman_entry {
-    uint32_t code;
-    uint8_t bits;
-};
-
-// Huffman encoding table for HPACK
-inline const std::array<huffman_entry, 257> huffman_table = {{
-    {0x1ff8, 13}, {0x7fffd8, 23}, {0xfffffe2, 28}, {0xfffffe3, 28},
-    {0xfffffe4, 28}, {0xfffffe5, 28}, {0xfffffe6, 28}, {0xfffffe7, 28},
-    {0xfffffe8, 28}, {0xffffea, 24}, {0x3ffffffc, 30}, {0xfffffe9, 28},
-    {0xfffffea, 28}, {0x3ffffffd, 30}, {0xfffffeb, 28}, {0xfffffec, 28},
-    {0xfffffed, 28}, {0xfffffee, 28}, {0xfffffef, 28}, {0xffffff0, 28},
-    {0xffffff1, 28}, {0xffffff2, 28}, {0x3ffffffe, 30}, {0xffffff3, 28},
-    {0xffffff4, 28}, {0xffffff5, 28}, {0xffffff6, 28}, {0xffffff7, 28},
-    {0xffffff8, 28}, {0xffffff9, 28}, {0xffffffa, 28}, {0xffffffb, 28},
-    {0x14, 6}, {0x3f8, 10}, {0x3f9, 10}, {0xffa, 12}, {0x1ff9, 13},
-    {0x15, 6}, {0xf8, 8}, {0x7fa, 11}, {0x3fa, 10}, {0x3fb, 10},
-    {0xf9, 8}, {0x7fb, 11}, {0xfa, 8}, {0x16, 6}, {0x17, 6}, {0x18, 6},
-    {0x0, 5}, {0x1, 5}, {0x2, 5}, {0x19, 6}, {0x1a, 6}, {0x1b, 6},
-    {0x1c, 6}, {0x1d, 6}, {0x1e, 6}, {0x1f, 6}, {0x5c, 7}, {0xfb, 8},
-    {0x7ffc, 15}, {0x20, 6}, {0xffb, 12}, {0x3fc, 10}, {0x1ffa, 13},
-    {0x21, 6}, {0x5d, 7}, {0x5e, 7}, {0x5f, 7}, {0x60, 7}, {0x61, 7},
-    {0x62, 7}, {0x63, 7}, {0x64, 7}, {0x65, 7}, {0x66, 7}, {0x67, 7},
-    {0x68, 7}, {0x69, 7}, {0x6a, 7}, {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
-    {0x6e, 7}, {0x6f, 7}, {0x70, 7}, {0x71, 7}, {0x72, 7}, {0xfc, 8},
-    {0x73, 7}, {0xfd, 8}, {0x1ffb, 13}, {0x7fff0, 19}, {0x1ffc, 13},
-    {0x3ffc, 14}, {0x22, 6}, {0x7ffd, 15}, {0x3, 5}, {0x23, 6}, {0x4, 5},
-    {0x24, 6}, {0x5, 5}, {0x25, 6}, {0x26, 6}, {0x27, 6}, {0x6, 5},
-    {0x74, 7}, {0x75, 7}, {0x28, 6}, {0x29, 6}, {0x2a, 6}, {0x7, 5},
-    {0x2b, 6}, {0x76, 7}, {0x2c, 6}, {0x8, 5}, {0x9, 5}, {0x2d, 6},
-    {0x77, 7}, {0x78, 7}, {0x79, 7}, {0x7a, 7}, {0x7b, 7}, {0x7ffe, 15},
-    {0x7fc, 11}, {0x3ffd, 14}, {0x1ffd, 13}, {0xffffffc, 28}, {0xfffe6, 20},
-    {0x3fffd2, 22}, {0xfffe7, 20}, {0xfffe8, 20}, {0x3fffd3, 22}, {0x3fffd4, 22},
-    {0x3fffd5, 22}, {0x7fffd9, 23}, {0x3fffd6, 22}, {0x7fffda, 23}, {0x7fffdb, 23},
-    {0x7fffdc, 23}, {0x7fffdd, 23}, {0x7fffde, 23}, {0xffffeb, 24}, {0x7fffdf, 23},
-    {0xffffec, 24}, {0xffffed, 24}, {0x3fffd7, 22}, {0x7fffe0, 23}, {0xffffee, 24},
-    {0x7fffe1, 23}, {0x7fffe2, 23}, {0x7fffe3, 23}, {0x7fffe4, 23}, {0x1fffdc, 21},
-    {0x3fffd8, 22}, {0x7fffe5, 23}, {0x3fffd9, 22}, {0x7fffe6, 23}, {0x7fffe7, 23},
-    {0xffffef, 24}, {0x3fffda, 22}, {0x1fffdd, 21}, {0xfffe9, 20}, {0x3fffdb, 22},
-    {0x3fffdc, 22}, {0x7fffe8, 23}, {0x7fffe9, 23}, {0x1fffde, 21}, {0x7fffea, 23},
-    {0x3fffdd, 22}, {0x3fffde, 22}, {0xfffff0, 24}, {0x1fffdf, 21}, {0x3fffdf, 22},
-    {0x7fffeb, 23}, {0x7fffec, 23}, {0x1fffe0, 21}, {0x1fffe1, 21}, {0x3fffe0, 22},
-    {0x1fffe2, 21}, {0x7fffed, 23}, {0x3fffe1, 22}, {0x7fffee, 23}, {0x7fffef, 23},
-    {0xfffea, 20}, {0x3fffe2, 22}, {0x3fffe3, 22}, {0x3fffe4, 22}, {0x7ffff0, 23},
-    {0x3fffe5, 22}, {0x3fffe6, 22}, {0x7ffff1, 23}, {0x3ffffe0, 26}, {0x3ffffe1, 26},
-    {0xfffeb, 20}, {0x7fff1, 19}, {0x3fffe7, 22}, {0x7ffff2, 23}, {0x3fffe8, 22},
-    {0x1ffffec, 25}, {0x3ffffe2, 26}, {0x3ffffe3, 26}, {0x3ffffe4, 26}, {0x7ffffde, 27},
-    {0x7ffffdf, 27}, {0x3ffffe5, 26}, {0xfffff1, 24}, {0x1ffffed, 25}, {0x7fff2, 19},
-    {0x1fffe3, 21}, {0x3ffffe6, 26}, {0x7ffffe0, 27}, {0x7ffffe1, 27}, {0x3ffffe7, 26},
-    {0x7ffffe2, 27}, {0xfffff2, 24}, {0x1fffe4, 21}, {0x1fffe5, 21}, {0x3ffffe8, 26},
-    {0x3ffffe9, 26}, {0xffffffd, 28}, {0x7ffffe3, 27}, {0x7ffffe4, 27}, {0x7ffffe5, 27},
-    {0xfffec, 20}, {0xfffff3, 24}, {0xfffed, 20}, {0x1fffe6, 21}, {0x3fffe9, 22},
-    {0x1fffe7, 21}, {0x1fffe8, 21}, {0x7ffff3, 23}, {0x3fffea, 22}, {0x3fffeb, 22},
-    {0x1ffffee, 25}, {0x1ffffef, 25}, {0xfffff4, 24}, {0xfffff5, 24}, {0x3ffffea, 26},
-    {0x7ffff4, 23}, {0x3ffffeb, 26}, {0x7ffffe6, 27}, {0x3ffffec, 26}, {0x3ffffed, 26},
-    {0x7ffffe7, 27}, {0x7ffffe8, 27}, {0x7ffffe9, 27}, {0x7ffffea, 27}, {0x7ffffeb, 27},
-    {0xffffffe, 28}, {0x7ffffec, 27}, {0x7ffffed, 27}, {0x7ffffee, 27}, {0x7ffffef, 27},
-    {0x7fffff0, 27}, {0x3ffffee, 26}, {0x3fffffff, 30}
-}};
-
 } // namespace co::http::detail
 
 // Include implementation
@@ -2,43 +2,212 @@
 
 #include "hpack.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace co::http::detail {
 
+// =============================================================================
+// HPACK Dynamic Table Implementation
+// =============================================================================
+
+inline hpack_dynamic_table::hpack_dynamic_table(uint32_t max_size) {
+    set_max_size(max_size);
+}
+
+inline std::pair<std::string_view, std::string_view>
+hpack_dynamic_table::at(size_t index) const noexcept {
+    const entry_ref& ref = ref_at(index);
+    const char* base = arena_.get() + ref.offset;
+    return {std::string_view(base, ref.name_len),
+            std::string_view(base + ref.name_len, ref.value_len)};
+}
+
+inline std::pair<std::string_view, std::string_view>
+hpack_dynamic_table::back() const noexcept {
+    return at(count_ - 1);
+}
+
+inline uint64_t hpack_dynamic_table::back_seq() const noexcept {
+    return ref_at(count_ - 1).seq;
+}
+
+inline void hpack_dynamic_table::push_front(std::string_view name, std::string_view value, uint64_t seq) {
+    const size_t length = name.size() + value.size();
+
+    size_t offset;
+    if (count_ == 0) {
+        write_off_ = 0;
+        offset = 0;
+    } else if (write_off_ >= ring_[head_].offset) {
+        // Live characters do not wrap; either extend at the tail or skip the
+        // remainder and restart at the front (eviction accounting guarantees
+        // the front is clear, see the class comment)
+        offset = (arena_cap_ - write_off_ >= length) ? write_off_ : 0;
+    } else {
+        // Live characters wrap; the gap before the oldest entry fits us
+        offset = write_off_;
+    }
+
+    std::memcpy(arena_.get() + offset, name.data(), name.size());
+    std::memcpy(arena_.get() + offset + name.size(), value.data(), value.size());
+    write_off_ = offset + length;
+
+    entry_ref& ref = ring_[(head_ + count_) % ring_cap_];
+    ref.offset = static_cast<uint32_t>(offset);
+    ref.name_len = static_cast<uint32_t>(name.size());
+    ref.value_len = static_cast<uint32_t>(value.size());
+    ref.seq = seq;
+    ++count_;
+    accounted_size_ += length + 32;
+}
+
+inline void hpack_dynamic_table::pop_back() {
+    if (count_ == 0) {
+        return;
+    }
+    accounted_size_ -= ring_[head_].size();
+    head_ = (head_ + 1) % ring_cap_;
+    --count_;
+}
+
+inline void hpack_dynamic_table::set_max_size(uint32_t max_size) {
+    // Entries are at least 32 accounted bytes, bounding the descriptor count
+    const size_t new_ring_cap = max_size / 32 + 1;
+    const size_t new_arena_cap = static_cast<size_t>(max_size) * 2;
+    auto new_arena = new_arena_cap > 0 ? std::make_unique<char[]>(new_arena_cap) : nullptr;
+    auto new_ring = std::make_unique<entry_ref[]>(new_ring_cap);
+
+    // Re-pack surviving entries oldest-first into the fresh arena
+    size_t off = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        const entry_ref& ref = ring_[(head_ + i) % ring_cap_];
+        std::memcpy(new_arena.get() + off, arena_.get() + ref.offset,
+                    ref.name_len + ref.value_len);
+        new_ring[i] = ref;
+        new_ring[i].offset = static_cast<uint32_t>(off);
+        off += ref.name_len + ref.value_len;
+    }
+
+    max_size_ = max_size;
+    arena_ = std::move(new_arena);
+    arena_cap_ = new_arena_cap;
+    write_off_ = off;
+    ring_ = std::move(new_ring);
+    ring_cap_ = new_ring_cap;
+    head_ = 0;
+}
+
+inline void hpack_dynamic_table::clear() {
+    head_ = 0;
+    count_ = 0;
+    write_off_ = 0;
+    accounted_size_ = 0;
+}
+
 // =============================================================================
 // HPACK Encoder Implementation
 // =============================================================================
 
+// Frozen hash maps over the RFC 7541 static table, built on first use.
+// Exact matches key on "name\0value"; name matches keep the first
+// (lowest) index for each name.
+inline const header_index_map& hpack_static_exact_index() {
+    static const header_index_map index = [] {
+        header_index_map map;
+        std::string key;
+        for (size_t i = 0; i < hpack_encoder::static_table_.size(); ++i) {
+            make_exact_key(key, hpack_encoder::static_table_[i].first,
+                           hpack_encoder::static_table_[i].second);
+            map.try_emplace(key, i + 1); // 1-based indexing
+        }
+        return map;
+    }();
+    return index;
+}
+
+inline const header_index_map& hpack_static_name_index() {
+    static const header_index_map index = [] {
+        header_index_map map;
+        for (size_t i = 0; i < hpack_encoder::static_table_.size(); ++i) {
+            map.try_emplace(std::string(hpack_encoder::static_table_[i].first), i + 1);
+        }
+        return map;
+    }();
+    return index;
+}
+
 inline std::expected<size_t, error_code> hpack_encoder::encode_headers(const std::vector<header>& headers, output_buffer& output) {
     size_t initial_size = output.size();
     
     for (const auto& h : headers) {
+        stats_add(stats_.headers_encoded);
+        // Literal-only headers skip dynamic-table maintenance and Huffman
+        // coding entirely (see indexing_policy)
+        bool literal_only = policy_ == indexing_policy::throughput ||
+                            (policy_ == indexing_policy::adaptive &&
+                             adaptive_literal_mode_ && !adaptive_probing_);
+        huffman_enabled_ = !literal_only;
+
         // Check if header is in static or dynamic table
+        bool dynamic_hit = false;
         if (auto index = find_header_index(h.name, h.value)) {
             // Encode as indexed header field
+            dynamic_hit = *index > static_table_.size();
+            stats_add(dynamic_hit ? stats_.dynamic_hits : stats_.static_hits);
             encode_indexed_header(*index, output);
-        } else if (auto name_index = find_name_index(h.name)) {
-            // Encode as literal header field with incremental indexing (name indexed)
-            if (h.sensitive) {
-                encode_literal_header_never_indexed(h.name, h.value, output);
-            } else {
-                encode_literal_header_with_indexing(h.name, h.value, output);
-                add_to_dynamic_table(h.name, h.value);
-            }
+        } else if (h.sensitive) {
+            stats_add(stats_.literal_headers);
+            encode_literal_header_never_indexed(h.name, h.value, output);
+        } else if (literal_only) {
+            stats_add(stats_.literal_headers);
+            encode_literal_header_without_indexing(h.name, h.value, output);
         } else {
-            // Encode as literal header field with incremental indexing (new name)
-            if (h.sensitive) {
-                encode_literal_header_never_indexed(h.name, h.value, output);
-            } else {
-                encode_literal_header_with_indexing(h.name, h.value, output);
-                add_to_dynamic_table(h.name, h.value);
-            }
+            // Encode as literal header field with incremental indexing
+            stats_add(stats_.literal_headers);
+            encode_literal_header_with_indexing(h.name, h.value, output);
+            add_to_dynamic_table(h.name, h.value);
+        }
+
+        if (policy_ == indexing_policy::adaptive) {
+            adaptive_note(dynamic_hit);
         }
     }
-    
+    huffman_enabled_ = true;
+
     return output.size() - initial_size;
 }
 
+inline void hpack_encoder::adaptive_note(bool dynamic_hit) {
+    ++window_headers_;
+    if (dynamic_hit) {
+        ++window_dynamic_hits_;
+    }
+    if (window_headers_ < adaptive_window_) {
+        return;
+    }
+
+    // The dynamic table pays for itself when at least one header in eight
+    // resolves through it
+    bool paying = window_dynamic_hits_ * 8 >= window_headers_;
+    if (!adaptive_literal_mode_) {
+        if (!paying) {
+            adaptive_literal_mode_ = true;
+            probe_window_countdown_ = adaptive_probe_interval_;
+        }
+    } else if (adaptive_probing_) {
+        adaptive_probing_ = false;
+        if (paying) {
+            adaptive_literal_mode_ = false;
+        } else {
+            probe_window_countdown_ = adaptive_probe_interval_;
+        }
+    } else if (--probe_window_countdown_ == 0) {
+        adaptive_probing_ = true;
+    }
+    window_headers_ = 0;
+    window_dynamic_hits_ = 0;
+}
+
 inline size_t hpack_encoder::encode_indexed_header(size_t index, output_buffer& output) {
     // Pattern: 1xxxxxxx
     return encode_integer(static_cast<uint32_t>(index), 7, 0x80, output);
@@ -91,19 +260,27 @@ inline size_t hpack_encoder::encode_literal_header_without_indexing(std::string_
 
 inline size_t hpack_encoder::encode_string(std::string_view str, output_buffer& output, bool huffman) {
     size_t bytes_written = 0;
-    
-    if (huffman) {
-        // Simplified Huffman encoding - would use proper table in production
-        bytes_written += encode_integer(static_cast<uint32_t>(str.size()), 7, 0x80, output);
-        output.append(str);
-        bytes_written += str.size();
+
+    // Huffman coding only pays off when it actually shrinks the string;
+    // otherwise fall back to the raw representation. Literal-only policy
+    // modes skip the size scan altogether.
+    bool use_huffman = huffman && huffman_enabled_;
+    size_t huffman_size = use_huffman ? huffman::encoded_size(str) : 0;
+    if (use_huffman && huffman_size < str.size()) {
+        thread_local std::string encoded;
+        encoded.clear();
+        huffman::encode(str, encoded);
+        stats_add(stats_.huffman_bytes_in, str.size());
+        stats_add(stats_.huffman_bytes_out, encoded.size());
+        bytes_written += encode_integer(static_cast<uint32_t>(encoded.size()), 7, 0x80, output);
+        output.append(encoded);
+        bytes_written += encoded.size();
     } else {
-        // Encode without Huffman
         bytes_written += encode_integer(static_cast<uint32_t>(str.size()), 7, 0x00, output);
         output.append(str);
         bytes_written += str.size();
     }
-    
+
     return bytes_written;
 }
 
@@ -130,75 +307,90 @@ inline size_t hpack_encoder::encode_integer(uint32_t value, uint8_t prefix_bits,
 }
 
 inline std::optional<size_t> hpack_encoder::find_header_index(std::string_view name, std::string_view value) const {
-    // Search static table
-    for (size_t i = 0; i < static_table_.size(); ++i) {
-        if (static_table_[i].first == name && static_table_[i].second == value) {
-            return i + 1; // 1-based indexing
-        }
+    thread_local std::string key;
+    make_exact_key(key, name, value);
+
+    const auto& static_index = hpack_static_exact_index();
+    if (auto it = static_index.find(std::string_view(key)); it != static_index.end()) {
+        return it->second;
     }
-    
-    // Search dynamic table
-    for (size_t i = 0; i < dynamic_table_.size(); ++i) {
-        if (dynamic_table_[i].name == name && dynamic_table_[i].value == value) {
-            return static_table_.size() + i + 1;
-        }
+
+    if (auto it = dynamic_exact_index_.find(std::string_view(key));
+        it != dynamic_exact_index_.end()) {
+        // Newest insertion sits at dynamic position 0
+        return static_table_.size() + (insert_seq_ - 1 - it->second) + 1;
     }
-    
+
     return std::nullopt;
 }
 
 inline std::optional<size_t> hpack_encoder::find_name_index(std::string_view name) const {
-    // Search static table
-    for (size_t i = 0; i < static_table_.size(); ++i) {
-        if (static_table_[i].first == name) {
-            return i + 1;
-        }
+    const auto& static_index = hpack_static_name_index();
+    if (auto it = static_index.find(name); it != static_index.end()) {
+        return it->second;
     }
-    
-    // Search dynamic table
-    for (size_t i = 0; i < dynamic_table_.size(); ++i) {
-        if (dynamic_table_[i].name == name) {
-            return static_table_.size() + i + 1;
-        }
+
+    if (auto it = dynamic_name_index_.find(name); it != dynamic_name_index_.end()) {
+        return static_table_.size() + (insert_seq_ - 1 - it->second) + 1;
     }
-    
+
     return std::nullopt;
 }
 
 inline void hpack_encoder::add_to_dynamic_table(std::string_view name, std::string_view value) {
-    dynamic_entry entry{std::string(name), std::string(value)};
-    size_t entry_size = entry.size();
-    
+    size_t entry_size = name.size() + value.size() + 32;
+
     // Evict entries if necessary
-    while (dynamic_table_current_size_ + entry_size > dynamic_table_size_ && !dynamic_table_.empty()) {
+    while (dynamic_table_.size() + entry_size > dynamic_table_.max_size() && !dynamic_table_.empty()) {
         evict_from_dynamic_table();
     }
-    
-    if (entry_size <= dynamic_table_size_) {
-        dynamic_table_.insert(dynamic_table_.begin(), std::move(entry));
-        dynamic_table_current_size_ += entry_size;
+
+    if (entry_size <= dynamic_table_.max_size()) {
+        thread_local std::string key;
+        make_exact_key(key, name, value);
+        dynamic_exact_index_[key] = insert_seq_;
+        dynamic_name_index_[std::string(name)] = insert_seq_;
+
+        dynamic_table_.push_front(name, value, insert_seq_);
+        ++insert_seq_;
     }
 }
 
 inline void hpack_encoder::evict_from_dynamic_table() {
     if (!dynamic_table_.empty()) {
-        dynamic_table_current_size_ -= dynamic_table_.back().size();
+        auto [victim_name, victim_value] = dynamic_table_.back();
+        uint64_t victim_seq = dynamic_table_.back_seq();
+
+        // Drop index entries only if they still refer to the evicted slot;
+        // a newer insertion of the same name/value keeps its mapping
+        thread_local std::string key;
+        make_exact_key(key, victim_name, victim_value);
+        if (auto it = dynamic_exact_index_.find(std::string_view(key));
+            it != dynamic_exact_index_.end() && it->second == victim_seq) {
+            dynamic_exact_index_.erase(it);
+        }
+        if (auto it = dynamic_name_index_.find(victim_name);
+            it != dynamic_name_index_.end() && it->second == victim_seq) {
+            dynamic_name_index_.erase(it);
+        }
+
         dynamic_table_.pop_back();
     }
 }
 
 inline void hpack_encoder::set_dynamic_table_size(uint32_t size) {
-    dynamic_table_size_ = size;
-    
     // Evict entries if new size is smaller
-    while (dynamic_table_current_size_ > dynamic_table_size_ && !dynamic_table_.empty()) {
+    while (dynamic_table_.size() > size && !dynamic_table_.empty()) {
         evict_from_dynamic_table();
     }
+    dynamic_table_.set_max_size(size);
 }
 
 inline void hpack_encoder::clear_dynamic_table() {
     dynamic_table_.clear();
-    dynamic_table_current_size_ = 0;
+    dynamic_exact_index_.clear();
+    dynamic_name_index_.clear();
+    insert_seq_ = 0;
 }
 
 // =============================================================================
@@ -253,7 +445,8 @@ inline std::expected<std::vector<header>, error_code> hpack_decoder::decode_head
             headers.push_back(std::move(h));
         }
     }
-    
+
+    stats_add(stats_.headers_decoded, headers.size());
     return headers;
 }
 
@@ -267,7 +460,9 @@ inline std::expected<size_t, error_code> hpack_decoder::decode_indexed_header(st
     if (!header_result) {
         return std::unexpected{header_result.error()};
     }
-    
+
+    stats_add(*index_result <= static_table_.size() ? stats_.static_hits
+                                                    : stats_.dynamic_hits);
     result.name = std::string(header_result->first);
     result.value = std::string(header_result->second);
     
@@ -276,7 +471,8 @@ inline std::expected<size_t, error_code> hpack_decoder::decode_indexed_header(st
 
 inline std::expected<size_t, error_code> hpack_decoder::decode_literal_header(std::span<const uint8_t> data, size_t& pos, header& result, bool with_indexing, bool never_indexed) {
     uint8_t prefix_bits = with_indexing ? 6 : (never_indexed ? 4 : 4);
-    
+    stats_add(stats_.literal_headers);
+
     auto name_index_result = decode_integer(data, pos, prefix_bits);
     if (!name_index_result) {
         return std::unexpected{name_index_result.error()};
@@ -361,14 +557,19 @@ inline std::expected<std::string, error_code> hpack_decoder::decode_string(std::
     }
     
     std::string result;
-    
+
     if (huffman_encoded) {
-        // Simplified - real implementation would decode Huffman
-        result = std::string(reinterpret_cast<const char*>(data.data() + pos), length);
+        auto decoded = huffman::decode(data.data() + pos, length);
+        if (!decoded) {
+            return std::unexpected{error_code::compression_error};
+        }
+        stats_add(stats_.huffman_bytes_in, length);
+        stats_add(stats_.huffman_bytes_out, decoded->size());
+        result = std::move(*decoded);
     } else {
         result = std::string(reinterpret_cast<const char*>(data.data() + pos), length);
     }
-    
+
     pos += length;
     return result;
 }
@@ -383,12 +584,11 @@ inline std::expected<std::pair<std::string_view, std::string_view>, error_code>
     }
     
     size_t dynamic_index = index - static_table_.size() - 1;
-    if (dynamic_index >= dynamic_table_.size()) {
+    if (dynamic_index >= dynamic_table_.count()) {
         return std::unexpected{error_code::protocol_error};
     }
-    
-    const auto& entry = dynamic_table_[dynamic_index];
-    return std::pair<std::string_view, std::string_view>{entry.name, entry.value};
+
+    return dynamic_table_.at(dynamic_index);
 }
 
 inline std::expected<std::string_view, error_code> hpack_decoder::get_name_by_index(size_t index) const {
@@ -400,39 +600,32 @@ inline std::expected<std::string_view, error_code> hpack_decoder::get_name_by_in
 }
 
 inline void hpack_decoder::add_to_dynamic_table(std::string_view name, std::string_view value) {
-    dynamic_entry entry{std::string(name), std::string(value)};
-    size_t entry_size = entry.size();
-    
+    size_t entry_size = name.size() + value.size() + 32;
+
     // Evict entries if necessary
-    while (dynamic_table_current_size_ + entry_size > dynamic_table_size_ && !dynamic_table_.empty()) {
+    while (dynamic_table_.size() + entry_size > dynamic_table_.max_size() && !dynamic_table_.empty()) {
         evict_from_dynamic_table();
     }
-    
-    if (entry_size <= dynamic_table_size_) {
-        dynamic_table_.insert(dynamic_table_.begin(), std::move(entry));
-        dynamic_table_current_size_ += entry_size;
+
+    if (entry_size <= dynamic_table_.max_size()) {
+        dynamic_table_.push_front(name, value);
     }
 }
 
 inline void hpack_decoder::evict_from_dynamic_table() {
-    if (!dynamic_table_.empty()) {
-        dynamic_table_current_size_ -= dynamic_table_.back().size();
-        dynamic_table_.pop_back();
-    }
+    dynamic_table_.pop_back();
 }
 
 inline void hpack_decoder::set_dynamic_table_size(uint32_t size) {
-    dynamic_table_size_ = size;
-    
     // Evict entries if new size is smaller
-    while (dynamic_table_current_size_ > dynamic_table_size_ && !dynamic_table_.empty()) {
+    while (dynamic_table_.size() > size && !dynamic_table_.empty()) {
         evict_from_dynamic_table();
     }
+    dynamic_table_.set_max_size(size);
 }
 
 inline void hpack_decoder::clear_dynamic_table() {
     dynamic_table_.clear();
-    dynamic_table_current_size_ = 0;
 }
 
 inline std::expected<size_t, error_code> hpack_decoder::decode_dynamic_table_size_update(std::span<const uint8_t> data, size_t& pos) {
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace co::http::detail {
+
+// =============================================================================
+// HPACK Huffman Codec (RFC 7541 Appendix B)
+//
+// Encode side packs whole bytes through a 64-bit accumulator using the
+// 257-entry code/length table. Decode side is a finite-state machine built
+// at compile time from the same table: each transition consumes 4 bits, so
+// a byte is decoded in two table lookups instead of up to eight tree steps.
+// =============================================================================
+
+struct huffman_entry {
+    uint32_t code;
+    uint8_t bits;
+};
+
+// Huffman encoding table for HPACK
+inline constexpr std::array<huffman_entry, 257> huffman_table = {{
+    {0x1ff8, 13}, {0x7fffd8, 23}, {0xfffffe2, 28}, {0xfffffe3, 28},
+    {0xfffffe4, 28}, {0xfffffe5, 28}, {0xfffffe6, 28}, {0xfffffe7, 28},
+    {0xfffffe8, 28}, {0xffffea, 24}, {0x3ffffffc, 30}, {0xfffffe9, 28},
+    {0xfffffea, 28}, {0x3ffffffd, 30}, {0xfffffeb, 28}, {0xfffffec, 28},
+    {0xfffffed, 28}, {0xfffffee, 28}, {0xfffffef, 28}, {0xffffff0, 28},
+    {0xffffff1, 28}, {0xffffff2, 28}, {0x3ffffffe, 30}, {0xffffff3, 28},
+    {0xffffff4, 28}, {0xffffff5, 28}, {0xffffff6, 28}, {0xffffff7, 28},
+    {0xffffff8, 28}, {0xffffff9, 28}, {0xffffffa, 28}, {0xffffffb, 28},
+    {0x14, 6}, {0x3f8, 10}, {0x3f9, 10}, {0xffa, 12}, {0x1ff9, 13},
+    {0x15, 6}, {0xf8, 8}, {0x7fa, 11}, {0x3fa, 10}, {0x3fb, 10},
+    {0xf9, 8}, {0x7fb, 11}, {0xfa, 8}, {0x16, 6}, {0x17, 6}, {0x18, 6},
+    {0x0, 5}, {0x1, 5}, {0x2, 5}, {0x19, 6}, {0x1a, 6}, {0x1b, 6},
+    {0x1c, 6}, {0x1d, 6}, {0x1e, 6}, {0x1f, 6}, {0x5c, 7}, {0xfb, 8},
+    {0x7ffc, 15}, {0x20, 6}, {0xffb, 12}, {0x3fc, 10}, {0x1ffa, 13},
+    {0x21, 6}, {0x5d, 7}, {0x5e, 7}, {0x5f, 7}, {0x60, 7}, {0x61, 7},
+    {0x62, 7}, {0x63, 7}, {0x64, 7}, {0x65, 7}, {0x66, 7}, {0x67, 7},
+    {0x68, 7}, {0x69, 7}, {0x6a, 7}, {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
+    {0x6e, 7}, {0x6f, 7}, {0x70, 7}, {0x71, 7}, {0x72, 7}, {0xfc, 8},
+    {0x73, 7}, {0xfd, 8}, {0x1ffb, 13}, {0x7fff0, 19}, {0x1ffc, 13},
+    {0x3ffc, 14}, {0x22, 6}, {0x7ffd, 15}, {0x3, 5}, {0x23, 6}, {0x4, 5},
+    {0x24, 6}, {0x5, 5}, {0x25, 6}, {0x26, 6}, {0x27, 6}, {0x6, 5},
+    {0x74, 7}, {0x75, 7}, {0x28, 6}, {0x29, 6}, {0x2a, 6}, {0x7, 5},
+    {0x2b, 6}, {0x76, 7}, {0x2c, 6}, {0x8, 5}, {0x9, 5}, {0x2d, 6},
+    {0x77, 7}, {0x78, 7}, {0x79, 7}, {0x7a, 7}, {0x7b, 7}, {0x7ffe, 15},
+    {0x7fc, 11}, {0x3ffd, 14}, {0x1ffd, 13}, {0xffffffc, 28}, {0xfffe6, 20},
+    {0x3fffd2, 22}, {0xfffe7, 20}, {0xfffe8, 20}, {0x3fffd3, 22}, {0x3fffd4, 22},
+    {0x3fffd5, 22}, {0x7fffd9, 23}, {0x3fffd6, 22}, {0x7fffda, 23}, {0x7fffdb, 23},
+    {0x7fffdc, 23}, {0x7fffdd, 23}, {0x7fffde, 23}, {0xffffeb, 24}, {0x7fffdf, 23},
+    {0xffffec, 24}, {0xffffed, 24}, {0x3fffd7, 22}, {0x7fffe0, 23}, {0xffffee, 24},
+    {0x7fffe1, 23}, {0x7fffe2, 23}, {0x7fffe3, 23}, {0x7fffe4, 23}, {0x1fffdc, 21},
+    {0x3fffd8, 22}, {0x7fffe5, 23}, {0x3fffd9, 22}, {0x7fffe6, 23}, {0x7fffe7, 23},
+    {0xffffef, 24}, {0x3fffda, 22}, {0x1fffdd, 21}, {0xfffe9, 20}, {0x3fffdb, 22},
+    {0x3fffdc, 22}, {0x7fffe8, 23}, {0x7fffe9, 23}, {0x1fffde, 21}, {0x7fffea, 23},
+    {0x3fffdd, 22}, {0x3fffde, 22}, {0xfffff0, 24}, {0x1fffdf, 21}, {0x3fffdf, 22},
+    {0x7fffeb, 23}, {0x7fffec, 23}, {0x1fffe0, 21}, {0x1fffe1, 21}, {0x3fffe0, 22},
+    {0x1fffe2, 21}, {0x7fffed, 23}, {0x3fffe1, 22}, {0x7fffee, 23}, {0x7fffef, 23},
+    {0xfffea, 20}, {0x3fffe2, 22}, {0x3fffe3, 22}, {0x3fffe4, 22}, {0x7ffff0, 23},
+    {0x3fffe5, 22}, {0x3fffe6, 22}, {0x7ffff1, 23}, {0x3ffffe0, 26}, {0x3ffffe1, 26},
+    {0xfffeb, 20}, {0x7fff1, 19}, {0x3fffe7, 22}, {0x7ffff2, 23}, {0x3fffe8, 22},
+    {0x1ffffec, 25}, {0x3ffffe2, 26}, {0x3ffffe3, 26}, {0x3ffffe4, 26}, {0x7ffffde, 27},
+    {0x7ffffdf, 27}, {0x3ffffe5, 26}, {0xfffff1, 24}, {0x1ffffed, 25}, {0x7fff2, 19},
+    {0x1fffe3, 21}, {0x3ffffe6, 26}, {0x7ffffe0, 27}, {0x7ffffe1, 27}, {0x3ffffe7, 26},
+    {0x7ffffe2, 27}, {0xfffff2, 24}, {0x1fffe4, 21}, {0x1fffe5, 21}, {0x3ffffe8, 26},
+    {0x3ffffe9, 26}, {0xffffffd, 28}, {0x7ffffe3, 27}, {0x7ffffe4, 27}, {0x7ffffe5, 27},
+    {0xfffec, 20}, {0xfffff3, 24}, {0xfffed, 20}, {0x1fffe6, 21}, {0x3fffe9, 22},
+    {0x1fffe7, 21}, {0x1fffe8, 21}, {0x7ffff3, 23}, {0x3fffea, 22}, {0x3fffeb, 22},
+    {0x1ffffee, 25}, {0x1ffffef, 25}, {0xfffff4, 24}, {0xfffff5, 24}, {0x3ffffea, 26},
+    {0x7ffff4, 23}, {0x3ffffeb, 26}, {0x7ffffe6, 27}, {0x3ffffec, 26}, {0x3ffffed, 26},
+    {0x7ffffe7, 27}, {0x7ffffe8, 27}, {0x7ffffe9, 27}, {0x7ffffea, 27}, {0x7ffffeb, 27},
+    {0xffffffe, 28}, {0x7ffffec, 27}, {0x7ffffed, 27}, {0x7ffffee, 27}, {0x7ffffef, 27},
+    {0x7fffff0, 27}, {0x3ffffee, 26}, {0x3fffffff, 30}
+}};
+
+// =============================================================================
+// Compile-Time FSM Construction
+// =============================================================================
+
+namespace huffman {
+
+inline constexpr uint8_t flag_emit = 0x01;    // Transition produced a symbol
+inline constexpr uint8_t flag_fail = 0x02;    // Invalid sequence (includes EOS)
+inline constexpr uint8_t flag_accept = 0x04;  // Valid stopping state after this nibble
+
+struct transition {
+    uint8_t next_state = 0;
+    uint8_t flags = 0;
+    uint8_t symbol = 0;
+};
+
+// 256 internal nodes of the code tree (the Huffman tree for 257 symbols is
+// a full binary tree), each with 16 nibble transitions
+struct decode_table {
+    std::array<std::array<transition, 16>, 256> states{};
+};
+
+struct code_tree {
+    // Children: >= 0 is an internal node id, < 0 encodes leaf symbol -(s+1)
+    std::array<std::array<int16_t, 2>, 256> child{};
+    int16_t node_count = 1;
+};
+
+consteval code_tree build_code_tree() {
+    code_tree tree;
+    for (auto& node : tree.child) {
+        node[0] = node[1] = INT16_MIN;
+    }
+    for (size_t sym = 0; sym < huffman_table.size(); ++sym) {
+        uint32_t code = huffman_table[sym].code;
+        uint8_t bits = huffman_table[sym].bits;
+        int16_t node = 0;
+        for (int depth = bits - 1; depth >= 0; --depth) {
+            int bit = (code >> depth) & 1;
+            if (depth == 0) {
+                tree.child[node][bit] = static_cast<int16_t>(-(static_cast<int>(sym) + 1));
+            } else {
+                if (tree.child[node][bit] == INT16_MIN) {
+                    tree.child[node][bit] = tree.node_count++;
+                }
+                node = tree.child[node][bit];
+            }
+        }
+    }
+    return tree;
+}
+
+consteval decode_table build_decode_table() {
+    const code_tree tree = build_code_tree();
+    decode_table table;
+
+    // States on the all-ones path of depth < 8 are valid padding stops
+    std::array<bool, 256> accept_state{};
+    {
+        int16_t node = 0;
+        for (int depth = 0; depth < 8 && node >= 0; ++depth) {
+            accept_state[node] = true;
+            node = tree.child[node][1];
+        }
+    }
+
+    for (int state = 0; state < tree.node_count; ++state) {
+        for (int nibble = 0; nibble < 16; ++nibble) {
+            transition t;
+            int16_t node = static_cast<int16_t>(state);
+            for (int bit_pos = 3; bit_pos >= 0; --bit_pos) {
+                int bit = (nibble >> bit_pos) & 1;
+                int16_t next = tree.child[node][bit];
+                if (next >= 0) {
+                    node = next;
+                    continue;
+                }
+                int sym = -static_cast<int>(next) - 1;
+                if (sym == 256) {
+                    // EOS inside the payload is a coding error (RFC 7541 5.2)
+                    t.flags |= flag_fail;
+                    break;
+                }
+                t.flags |= flag_emit;
+                t.symbol = static_cast<uint8_t>(sym);
+                node = 0;
+            }
+            if (!(t.flags & flag_fail)) {
+                t.next_state = static_cast<uint8_t>(node);
+                if (accept_state[node]) {
+                    t.flags |= flag_accept;
+                }
+            }
+            table.states[state][nibble] = t;
+        }
+    }
+    return table;
+}
+
+inline constexpr decode_table decoder_fsm = build_decode_table();
+
+// Number of bytes `str` occupies when Huffman coded
+inline size_t encoded_size(std::string_view str) noexcept {
+    size_t bits = 0;
+    for (unsigned char c : str) {
+        bits += huffman_table[c].bits;
+    }
+    return (bits + 7) / 8;
+}
+
+// Appends the Huffman coding of `str` to `out`, padding with EOS prefix bits
+inline void encode(std::string_view str, std::string& out) {
+    uint64_t accumulator = 0;
+    int bit_count = 0;
+    for (unsigned char c : str) {
+        const huffman_entry& entry = huffman_table[c];
+        accumulator = (accumulator << entry.bits) | entry.code;
+        bit_count += entry.bits;
+        while (bit_count >= 8) {
+            bit_count -= 8;
+            out.push_back(static_cast<char>((accumulator >> bit_count) & 0xFF));
+        }
+    }
+    if (bit_count > 0) {
+        // Pad the final byte with the most significant bits of EOS (all ones)
+        out.push_back(static_cast<char>(
+            ((accumulator << (8 - bit_count)) | (0xFF >> bit_count)) & 0xFF));
+    }
+}
+
+// Decodes `data` via the nibble FSM; nullopt on invalid coding or padding
+inline std::optional<std::string> decode(const uint8_t* data, size_t size) {
+    std::string out;
+    out.reserve(size * 2);
+
+    uint8_t state = 0;
+    bool accept = true;
+    for (size_t i = 0; i < size; ++i) {
+        for (int half = 1; half >= 0; --half) {
+            uint8_t nibble = (data[i] >> (4 * half)) & 0x0F;
+            const huffman::transition& t = huffman::decoder_fsm.states[state][nibble];
+            if (t.flags & huffman::flag_fail) {
+                return std::nullopt;
+            }
+            if (t.flags & huffman::flag_emit) {
+                out.push_back(static_cast<char>(t.symbol));
+            }
+            state = t.next_state;
+            accept = (t.flags & huffman::flag_accept) != 0;
+        }
+    }
+    if (!accept) {
+        return std::nullopt;
+    }
+    return out;
+}
+
+} // namespace huffman
+
+} // namespace co::http::detail
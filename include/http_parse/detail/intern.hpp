@@ -0,0 +1,111 @@
+#pragma once
+
+#include "token_tables.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace co::http::detail {
+
+// =============================================================================
+// Header Name Interning
+// =============================================================================
+
+// Real traffic repeats the same few dozen header names on every message, so
+// copying each name per request is pure waste. The interner hands out stable
+// string_views for names: the static vocabulary (the common-name perfect
+// hash above plus the remaining RFC 7541 Appendix B static table names and
+// HTTP/2 pseudo-headers) resolves without any copy, and a previously unseen
+// name is copied exactly once into the atom table - every later occurrence
+// of the same bytes returns the same view. Two interned names are therefore
+// equal iff their data pointers and lengths are equal.
+
+// Names from the HPACK static table (RFC 7541 Appendix B) that are not
+// already covered by common_header_names, plus the pseudo-headers
+inline constexpr std::array<std::string_view, 23> hpack_static_only_names = {
+    ":authority",
+    ":method",
+    ":path",
+    ":scheme",
+    ":status",
+    "access-control-allow-origin",
+    "allow",
+    "content-disposition",
+    "content-language",
+    "content-location",
+    "from",
+    "if-match",
+    "if-range",
+    "if-unmodified-since",
+    "link",
+    "max-forwards",
+    "proxy-authenticate",
+    "proxy-authorization",
+    "refresh",
+    "retry-after",
+    "strict-transport-security",
+    "via",
+    "www-authenticate",
+};
+
+// Shared immutable set over the static vocabulary, built on first use (same
+// pattern as the frozen HPACK index maps in hpack_impl.hpp)
+inline const std::unordered_set<std::string_view>& static_header_name_atoms() {
+    static const std::unordered_set<std::string_view> atoms = [] {
+        std::unordered_set<std::string_view> set;
+        set.reserve(common_header_names.size() + hpack_static_only_names.size());
+        set.insert(common_header_names.begin(), common_header_names.end());
+        set.insert(hpack_static_only_names.begin(), hpack_static_only_names.end());
+        return set;
+    }();
+    return atoms;
+}
+
+class header_name_interner {
+public:
+    // Growth cap: past this many distinct dynamic names (an adversarial
+    // client inventing names, not real traffic) intern() stops copying and
+    // returns the input view unchanged, so memory stays bounded
+    static constexpr size_t max_atoms = 4096;
+
+    // Returns a view of `name` that is stable for the interner's lifetime,
+    // except when the cap is hit and the name is unknown - then `name` is
+    // returned as-is and keeps the caller's lifetime. Matching is by exact
+    // bytes; canonicalize case before interning if needed.
+    std::string_view intern(std::string_view name) {
+        const auto& statics = static_header_name_atoms();
+        if (auto it = statics.find(name); it != statics.end()) {
+            return *it;
+        }
+        if (auto it = atoms_.find(name); it != atoms_.end()) {
+            return *it;
+        }
+        if (atoms_.size() >= max_atoms) {
+            return name;
+        }
+        return *atoms_.emplace(name).first;
+    }
+
+    // Distinct dynamically interned names (excludes the static vocabulary)
+    size_t size() const noexcept { return atoms_.size(); }
+
+    // Per-thread instance used by the parsing hot paths
+    static header_name_interner& local() {
+        thread_local header_name_interner instance;
+        return instance;
+    }
+
+private:
+    struct transparent_hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    // Node-based, so the stored strings never move
+    std::unordered_set<std::string, transparent_hash, std::equal_to<>> atoms_;
+};
+
+} // namespace co::http::detail
@@ -3,10 +3,15 @@
 #include "../parser.hpp"
 #include "../core.hpp"
 #include "hpack_impl.hpp"
+#include "intern.hpp"
+#include "scan.hpp"
+#include "stats.hpp"
 #include <sstream>
 #include <algorithm>
 #include <cctype>
 #include <charconv>
+#include <cstring>
+#include <type_traits>
 
 namespace co::http {
 
@@ -17,28 +22,33 @@ namespace co::http {
 class parser::impl {
 public:
     enum class parse_state {
-        method,
-        uri,
-        version,
-        header_name,
-        header_value,
+        start_line,
+        headers,
         body,
+        chunk_size,
+        chunk_data,
+        chunk_data_end,
+        trailers,
         complete,
         error
     };
 
     version version_ = version::auto_detect;
-    parse_state state_ = parse_state::method;
+    parse_state state_ = parse_state::start_line;
     version detected_version_ = version::http_1_1;
     bool parse_complete_ = false;
     bool needs_more_data_ = false;
-    
-    // HTTP/1.x parsing state
-    std::string current_header_name_;
+
+    // HTTP/1.x incremental parsing state. Only the current, still incomplete
+    // line is buffered, so resumed calls never re-scan consumed input and
+    // continuation chunks do not have to be contiguous.
+    std::string partial_line_;
     size_t content_length_ = 0;
     size_t body_bytes_read_ = 0;
+    size_t chunk_remaining_ = 0;
     bool chunked_encoding_ = false;
     bool connection_close_ = false;
+    bool upgraded_ = false;
     
     // HTTP/2 callbacks
     parser::stream_request_callback stream_request_cb_;
@@ -56,19 +66,38 @@ public:
     
     // HPACK decoder
     detail::hpack_decoder hpack_decoder_;
-    
+
+    // Streaming body delivery (empty = copy body into message::body)
+    parser::body_callback body_cb_;
+
+    // Optional arena backing view-parse storage
+    message_arena* arena_ = nullptr;
+
+    // Instrumentation counters
+    parser::stats stats_;
+
     impl(version ver) : version_(ver) {}
+    impl(version ver, message_arena& arena) : version_(ver), arena_(&arena) {}
     
     void reset() {
-        state_ = parse_state::method;
+        state_ = parse_state::start_line;
         parse_complete_ = false;
         needs_more_data_ = false;
-        current_header_name_.clear();
+        partial_line_.clear();
         content_length_ = 0;
         body_bytes_read_ = 0;
+        chunk_remaining_ = 0;
         chunked_encoding_ = false;
         connection_close_ = false;
+        upgraded_ = false;
     }
+
+    // Resumable incremental parsing (definitions follow the detail helpers)
+    bool take_line(std::string_view data, size_t& pos, std::string& line);
+    std::expected<void, error_code> parse_start_line(std::string_view line, request& req);
+    std::expected<void, error_code> parse_start_line(std::string_view line, response& resp);
+    template <typename Msg>
+    std::expected<size_t, error_code> parse_http1_incremental(std::span<const char> data, Msg& msg);
 };
 
 // =============================================================================
@@ -77,6 +106,9 @@ public:
 
 inline parser::parser(version ver) : pimpl_(std::make_unique<impl>(ver)) {}
 
+inline parser::parser(version ver, message_arena& arena)
+    : pimpl_(std::make_unique<impl>(ver, arena)) {}
+
 inline parser::~parser() = default;
 
 inline parser::parser(parser&&) noexcept = default;
@@ -98,6 +130,22 @@ inline void parser::reset() noexcept {
     pimpl_->reset();
 }
 
+inline bool parser::is_upgraded() const noexcept {
+    return pimpl_->upgraded_;
+}
+
+inline void parser::enter_tunnel_mode() noexcept {
+    pimpl_->upgraded_ = true;
+}
+
+inline const parser::stats& parser::get_stats() const noexcept {
+    return pimpl_->stats_;
+}
+
+inline void parser::reset_stats() noexcept {
+    pimpl_->stats_ = {};
+}
+
 // =============================================================================
 // HTTP/1.x Parsing Implementation
 // =============================================================================
@@ -105,7 +153,7 @@ inline void parser::reset() noexcept {
 namespace detail {
 
 inline std::pair<std::string_view, std::string_view> split_first(std::string_view str, char delimiter) {
-    auto pos = str.find(delimiter);
+    auto pos = find_char(str, delimiter);
     if (pos == std::string_view::npos) {
         return {str, {}};
     }
@@ -122,15 +170,105 @@ inline std::string_view trim(std::string_view str) {
 }
 
 inline bool iequals(std::string_view a, std::string_view b) {
-    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
-        [](char ca, char cb) { return std::tolower(ca) == std::tolower(cb); });
+    return iequals_ascii(a, b);
+}
+
+// Decodes a chunked body starting at `pos`, delivering each chunk as a
+// zero-copy slice. The final callback carries an empty span once the
+// terminating chunk and any trailers have been consumed.
+inline std::expected<void, error_code>
+deliver_chunked_body(std::string_view data, size_t pos, const parser::body_callback& cb) {
+    while (true) {
+        auto line_end = find_crlf(data, pos);
+        if (line_end == std::string_view::npos) {
+            return std::unexpected(error_code::need_more_data);
+        }
+
+        auto [size_str, extensions] = split_first(data.substr(pos, line_end - pos), ';');
+        uint64_t chunk_size = 0;
+        if (!parse_hex_u64(size_str, chunk_size)) {
+            return std::unexpected(error_code::invalid_body);
+        }
+        pos = line_end + 2;
+
+        if (chunk_size == 0) {
+            // Skip the trailer section up to the terminating empty line
+            while (true) {
+                auto trailer_end = find_crlf(data, pos);
+                if (trailer_end == std::string_view::npos) {
+                    return std::unexpected(error_code::need_more_data);
+                }
+                bool empty_line = trailer_end == pos;
+                pos = trailer_end + 2;
+                if (empty_line) {
+                    break;
+                }
+            }
+            cb({}, true);
+            return {};
+        }
+
+        if (pos + chunk_size + 2 > data.size()) {
+            return std::unexpected(error_code::need_more_data);
+        }
+        cb(std::span<const char>(data.data() + pos, chunk_size), false);
+        pos += chunk_size;
+        if (data.substr(pos, 2) != "\r\n") {
+            return std::unexpected(error_code::invalid_body);
+        }
+        pos += 2;
+    }
 }
 
-inline std::expected<request, error_code> parse_http1_request(std::string_view data) {
+// Consumes the body section at `pos`: copied into msg.body by default, or
+// delivered as zero-copy slices when a body callback is active
+inline std::expected<void, error_code>
+consume_http1_body(std::string_view data, size_t pos, message& msg,
+                   const parser::body_callback* body_cb) {
+    if (pos >= data.size()) {
+        return {};
+    }
+
+    if (body_cb) {
+        auto transfer_encoding = msg.get_header("transfer-encoding");
+        if (transfer_encoding && iequals(trim(*transfer_encoding), "chunked")) {
+            return deliver_chunked_body(data, pos, *body_cb);
+        }
+    }
+
+    auto content_length_hdr = msg.get_header("content-length");
+    if (content_length_hdr) {
+        uint64_t content_length;
+        if (parse_decimal_u64(*content_length_hdr, content_length)) {
+            if (data.size() - pos >= content_length) {
+                if (body_cb) {
+                    (*body_cb)(std::span<const char>(data.data() + pos, content_length), true);
+                } else {
+                    msg.body = std::string(data.substr(pos, content_length));
+                }
+            } else {
+                return std::unexpected(error_code::need_more_data);
+            }
+        }
+    } else {
+        // No content-length, assume rest is body
+        if (body_cb) {
+            (*body_cb)(std::span<const char>(data.data() + pos, data.size() - pos), true);
+        } else {
+            msg.body = std::string(data.substr(pos));
+        }
+    }
+
+    return {};
+}
+
+inline std::expected<request, error_code>
+parse_http1_request(std::string_view data, const parser::body_callback* body_cb = nullptr,
+                    parser::stats* stats = nullptr) {
     request req;
     
     // Find first line (request line)
-    auto line_end = data.find("\r\n");
+    auto line_end = find_crlf(data);
     if (line_end == std::string_view::npos) {
         return std::unexpected(error_code::need_more_data);
     }
@@ -153,18 +291,16 @@ inline std::expected<request, error_code> parse_http1_request(std::string_view d
     req.target = uri_str; // For HTTP/2 compatibility
     
     // Parse version
-    if (version_str == "HTTP/1.0") {
-        req.protocol_version = version::http_1_0;
-    } else if (version_str == "HTTP/1.1") {
-        req.protocol_version = version::http_1_1;
-    } else {
+    auto parsed_version = version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
         return std::unexpected(error_code::invalid_version);
     }
+    req.protocol_version = *parsed_version;
     
     // Parse headers
     size_t pos = line_end + 2;
     while (pos < data.size()) {
-        auto header_line_end = data.find("\r\n", pos);
+        auto header_line_end = find_crlf(data, pos);
         if (header_line_end == std::string_view::npos) {
             return std::unexpected(error_code::need_more_data);
         }
@@ -184,36 +320,27 @@ inline std::expected<request, error_code> parse_http1_request(std::string_view d
         req.add_header(std::string(trim(name)), std::string(trim(value)));
         pos = header_line_end + 2;
     }
-    
+
     // Parse body if present
-    if (pos < data.size()) {
-        auto content_length_hdr = req.get_header("content-length");
-        if (content_length_hdr) {
-            size_t content_length;
-            auto result = std::from_chars(content_length_hdr->data(), 
-                                        content_length_hdr->data() + content_length_hdr->size(), 
-                                        content_length);
-            if (result.ec == std::errc{}) {
-                if (data.size() - pos >= content_length) {
-                    req.body = std::string(data.substr(pos, content_length));
-                } else {
-                    return std::unexpected(error_code::need_more_data);
-                }
-            }
-        } else {
-            // No content-length, assume rest is body
-            req.body = std::string(data.substr(pos));
-        }
+    if (auto body_result = consume_http1_body(data, pos, req, body_cb); !body_result) {
+        return std::unexpected(body_result.error());
+    }
+
+    if (stats) {
+        stats_add(stats->start_line_bytes, line_end + 2);
+        stats_add(stats->header_bytes, pos - (line_end + 2));
+        stats_add(stats->body_bytes, data.size() - pos);
     }
-    
     return req;
 }
 
-inline std::expected<response, error_code> parse_http1_response(std::string_view data) {
+inline std::expected<response, error_code>
+parse_http1_response(std::string_view data, const parser::body_callback* body_cb = nullptr,
+                     parser::stats* stats = nullptr) {
     response resp;
     
     // Find first line (status line)
-    auto line_end = data.find("\r\n");
+    auto line_end = find_crlf(data);
     if (line_end == std::string_view::npos) {
         return std::unexpected(error_code::need_more_data);
     }
@@ -226,21 +353,20 @@ inline std::expected<response, error_code> parse_http1_response(std::string_view
         return std::unexpected(error_code::invalid_version);
     }
     
-    if (version_str == "HTTP/1.0") {
-        resp.protocol_version = version::http_1_0;
-    } else if (version_str == "HTTP/1.1") {
-        resp.protocol_version = version::http_1_1;
-    } else {
+    auto parsed_version = version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
         return std::unexpected(error_code::invalid_version);
     }
+    resp.protocol_version = *parsed_version;
     
     // Parse status code
     auto [status_str, reason_str] = split_first(rest1, ' ');
-    auto result = std::from_chars(status_str.data(), status_str.data() + status_str.size(), resp.status_code);
-    if (result.ec != std::errc{}) {
+    uint64_t status = 0;
+    if (!parse_decimal_u64(status_str, status) || status > 999) {
         return std::unexpected(error_code::protocol_error);
     }
-    
+    resp.status_code = static_cast<unsigned int>(status);
+
     if (!reason_str.empty()) {
         resp.reason_phrase = reason_str;
     }
@@ -248,7 +374,7 @@ inline std::expected<response, error_code> parse_http1_response(std::string_view
     // Parse headers and body (same logic as request)
     size_t pos = line_end + 2;
     while (pos < data.size()) {
-        auto header_line_end = data.find("\r\n", pos);
+        auto header_line_end = find_crlf(data, pos);
         if (header_line_end == std::string_view::npos) {
             return std::unexpected(error_code::need_more_data);
         }
@@ -269,25 +395,257 @@ inline std::expected<response, error_code> parse_http1_response(std::string_view
     }
     
     // Parse body
+    if (auto body_result = consume_http1_body(data, pos, resp, body_cb); !body_result) {
+        return std::unexpected(body_result.error());
+    }
+
+    if (stats) {
+        stats_add(stats->start_line_bytes, line_end + 2);
+        stats_add(stats->header_bytes, pos - (line_end + 2));
+        stats_add(stats->body_bytes, data.size() - pos);
+    }
+    return resp;
+}
+
+// =============================================================================
+// Zero-Copy View Parsing
+// =============================================================================
+
+// Parses the header block starting at `pos` into `msg.headers` and the body
+// into `msg.body`, without copying. Returns success or a parse error.
+inline std::expected<void, error_code>
+parse_http1_headers_and_body_view(std::string_view data, size_t pos, message_view& msg) {
+    while (pos < data.size()) {
+        auto header_line_end = find_crlf(data, pos);
+        if (header_line_end == std::string_view::npos) {
+            return std::unexpected(error_code::need_more_data);
+        }
+
+        auto header_line = data.substr(pos, header_line_end - pos);
+        if (header_line.empty()) {
+            // Empty line indicates end of headers
+            pos = header_line_end + 2;
+            break;
+        }
+
+        auto [name, value] = split_first(header_line, ':');
+        if (value.empty()) {
+            return std::unexpected(error_code::invalid_header);
+        }
+
+        msg.headers.emplace_back(trim(name), trim(value));
+        pos = header_line_end + 2;
+    }
+
+    // Body is the remainder, bounded by content-length when present
     if (pos < data.size()) {
-        auto content_length_hdr = resp.get_header("content-length");
+        auto content_length_hdr = msg.get_header("content-length");
         if (content_length_hdr) {
-            size_t content_length;
-            auto result = std::from_chars(content_length_hdr->data(), 
-                                        content_length_hdr->data() + content_length_hdr->size(), 
-                                        content_length);
-            if (result.ec == std::errc{}) {
+            uint64_t content_length;
+            if (parse_decimal_u64(*content_length_hdr, content_length)) {
                 if (data.size() - pos >= content_length) {
-                    resp.body = std::string(data.substr(pos, content_length));
+                    msg.body = data.substr(pos, content_length);
                 } else {
                     return std::unexpected(error_code::need_more_data);
                 }
             }
         } else {
-            resp.body = std::string(data.substr(pos));
+            msg.body = data.substr(pos);
         }
     }
-    
+
+    return {};
+}
+
+// Parses the request line into `req`; returns the offset of the header block
+inline std::expected<size_t, error_code>
+parse_http1_request_line_view(std::string_view data, request_view& req) {
+    auto line_end = find_crlf(data);
+    if (line_end == std::string_view::npos) {
+        return std::unexpected(error_code::need_more_data);
+    }
+
+    auto request_line = data.substr(0, line_end);
+
+    auto [method_str, rest1] = split_first(request_line, ' ');
+    if (rest1.empty()) {
+        return std::unexpected(error_code::invalid_method);
+    }
+    req.method_type = method_from_string(method_str);
+
+    auto [uri_str, version_str] = split_first(rest1, ' ');
+    if (version_str.empty()) {
+        return std::unexpected(error_code::invalid_uri);
+    }
+    req.uri = uri_str;
+
+    auto parsed_version = version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
+        return std::unexpected(error_code::invalid_version);
+    }
+    req.protocol_version = *parsed_version;
+
+    return line_end + 2;
+}
+
+// Parses the status line into `resp`; returns the offset of the header block
+inline std::expected<size_t, error_code>
+parse_http1_status_line_view(std::string_view data, response_view& resp) {
+    auto line_end = find_crlf(data);
+    if (line_end == std::string_view::npos) {
+        return std::unexpected(error_code::need_more_data);
+    }
+
+    auto status_line = data.substr(0, line_end);
+
+    auto [version_str, rest1] = split_first(status_line, ' ');
+    if (rest1.empty()) {
+        return std::unexpected(error_code::invalid_version);
+    }
+
+    auto parsed_version = version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
+        return std::unexpected(error_code::invalid_version);
+    }
+    resp.protocol_version = *parsed_version;
+
+    auto [status_str, reason_str] = split_first(rest1, ' ');
+    uint64_t status = 0;
+    if (!parse_decimal_u64(status_str, status) || status > 999) {
+        return std::unexpected(error_code::protocol_error);
+    }
+    resp.status_code = static_cast<unsigned int>(status);
+    resp.reason_phrase = reason_str;
+
+    return line_end + 2;
+}
+
+inline std::expected<request_view, error_code> parse_http1_request_view(std::string_view data) {
+    request_view req;
+
+    auto pos = parse_http1_request_line_view(data, req);
+    if (!pos) {
+        return std::unexpected(pos.error());
+    }
+
+    if (auto result = parse_http1_headers_and_body_view(data, *pos, req); !result) {
+        return std::unexpected(result.error());
+    }
+
+    return req;
+}
+
+inline std::expected<response_view, error_code> parse_http1_response_view(std::string_view data) {
+    response_view resp;
+
+    auto pos = parse_http1_status_line_view(data, resp);
+    if (!pos) {
+        return std::unexpected(pos.error());
+    }
+
+    if (auto hdr_result = parse_http1_headers_and_body_view(data, *pos, resp); !hdr_result) {
+        return std::unexpected(hdr_result.error());
+    }
+
+    return resp;
+}
+
+// =============================================================================
+// Selective Header Extraction
+// =============================================================================
+
+// True when `name` is one of the compile-time selected header names. The
+// fold expands to an unrolled chain of word-at-a-time compares specialized
+// for the name list - for the handful of headers a router reads, this beats
+// any hashing scheme.
+template <fixed_string... Names>
+inline bool header_selected(std::string_view name) noexcept {
+    return (iequals_ascii(name, Names.view()) || ...);
+}
+
+// Like parse_http1_headers_and_body_view, but stores only the selected
+// headers. Content-Length is tracked during the scan regardless, so body
+// framing stays correct even when it is not in the selection.
+template <fixed_string... Names>
+inline std::expected<void, error_code>
+parse_http1_headers_and_body_view_select(std::string_view data, size_t pos, message_view& msg) {
+    std::string_view content_length_value{};
+
+    while (pos < data.size()) {
+        auto header_line_end = find_crlf(data, pos);
+        if (header_line_end == std::string_view::npos) {
+            return std::unexpected(error_code::need_more_data);
+        }
+
+        auto header_line = data.substr(pos, header_line_end - pos);
+        if (header_line.empty()) {
+            pos = header_line_end + 2;
+            break;
+        }
+
+        auto [name, value] = split_first(header_line, ':');
+        if (value.empty()) {
+            return std::unexpected(error_code::invalid_header);
+        }
+
+        auto trimmed_name = trim(name);
+        auto trimmed_value = trim(value);
+        if (iequals_ascii(trimmed_name, "content-length")) {
+            content_length_value = trimmed_value;
+        }
+        if (header_selected<Names...>(trimmed_name)) {
+            msg.headers.emplace_back(trimmed_name, trimmed_value);
+        }
+        pos = header_line_end + 2;
+    }
+
+    if (pos < data.size()) {
+        if (!content_length_value.empty()) {
+            uint64_t content_length;
+            if (parse_decimal_u64(content_length_value, content_length)) {
+                if (data.size() - pos >= content_length) {
+                    msg.body = data.substr(pos, content_length);
+                } else {
+                    return std::unexpected(error_code::need_more_data);
+                }
+            }
+        } else {
+            msg.body = data.substr(pos);
+        }
+    }
+
+    return {};
+}
+
+template <fixed_string... Names>
+inline std::expected<request_view, error_code> parse_http1_request_view_select(std::string_view data) {
+    request_view req;
+
+    auto pos = parse_http1_request_line_view(data, req);
+    if (!pos) {
+        return std::unexpected(pos.error());
+    }
+
+    if (auto result = parse_http1_headers_and_body_view_select<Names...>(data, *pos, req); !result) {
+        return std::unexpected(result.error());
+    }
+
+    return req;
+}
+
+template <fixed_string... Names>
+inline std::expected<response_view, error_code> parse_http1_response_view_select(std::string_view data) {
+    response_view resp;
+
+    auto pos = parse_http1_status_line_view(data, resp);
+    if (!pos) {
+        return std::unexpected(pos.error());
+    }
+
+    if (auto result = parse_http1_headers_and_body_view_select<Names...>(data, *pos, resp); !result) {
+        return std::unexpected(result.error());
+    }
+
     return resp;
 }
 
@@ -323,8 +681,10 @@ inline response convert_h2_headers_to_response(const std::vector<header>& header
     
     for (const auto& hdr : headers) {
         if (hdr.name == ":status") {
-            auto result = std::from_chars(hdr.value.data(), hdr.value.data() + hdr.value.size(), resp.status_code);
-            if (result.ec != std::errc{}) {
+            uint64_t status = 0;
+            if (parse_decimal_u64(hdr.value, status) && status <= 999) {
+                resp.status_code = static_cast<unsigned int>(status);
+            } else {
                 resp.status_code = 500; // Default to server error
             }
         } else if (!hdr.name.starts_with(':')) {
@@ -339,42 +699,408 @@ inline response convert_h2_headers_to_response(const std::vector<header>& header
 
 } // namespace detail
 
+inline void parser::set_body_callback(body_callback callback) {
+    pimpl_->body_cb_ = std::move(callback);
+}
+
 inline std::expected<request, error_code> parser::parse_request(std::string_view data) {
-    return detail::parse_http1_request(data);
+    auto result = detail::parse_http1_request(data, pimpl_->body_cb_ ? &pimpl_->body_cb_ : nullptr,
+                                              &pimpl_->stats_);
+    if (result) {
+        detail::stats_add(pimpl_->stats_.requests_parsed);
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    return result;
 }
 
 inline std::expected<response, error_code> parser::parse_response(std::string_view data) {
-    return detail::parse_http1_response(data);
+    auto result = detail::parse_http1_response(data, pimpl_->body_cb_ ? &pimpl_->body_cb_ : nullptr,
+                                               &pimpl_->stats_);
+    if (result) {
+        detail::stats_add(pimpl_->stats_.responses_parsed);
+        if (result->status_code == 101) {
+            pimpl_->upgraded_ = true;
+        }
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    return result;
 }
 
-inline std::expected<size_t, error_code> parser::parse_request_incremental(std::span<const char> data, request& req) {
-    std::string_view data_view{data.data(), data.size()};
-    auto result = detail::parse_http1_request(data_view);
+namespace detail {
+
+// Re-points all views of `msg` at stable storage: header names dedup through
+// the shared atom table (one copy ever per distinct name, identical names
+// compare by pointer), values and body get arena copies
+inline void intern_message_views(message_view& msg, message_arena& arena) {
+    auto& interner = header_name_interner::local();
+    for (auto& h : msg.headers) {
+        std::string_view atom = interner.intern(h.name);
+        // The interner returns the input unchanged only when its cap is hit;
+        // those names still need an arena copy to outlive the input buffer
+        h.name = (atom.data() == h.name.data()) ? arena.copy(h.name) : atom;
+        h.value = arena.copy(h.value);
+    }
+    msg.body = arena.copy(msg.body);
+}
+
+} // namespace detail
+
+inline std::expected<request_view, error_code> parser::parse_request_view(std::string_view data) {
+    auto result = detail::parse_http1_request_view(data);
     if (result) {
-        req = std::move(*result);
-        pimpl_->parse_complete_ = true;
-        return data.size();
-    } else {
-        if (result.error() == error_code::need_more_data) {
-            pimpl_->needs_more_data_ = true;
-        }
-        return std::unexpected(result.error());
+        detail::stats_add(pimpl_->stats_.requests_parsed);
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    if (result && pimpl_->arena_) {
+        result->uri = pimpl_->arena_->copy(result->uri);
+        detail::intern_message_views(*result, *pimpl_->arena_);
     }
+    return result;
 }
 
-inline std::expected<size_t, error_code> parser::parse_response_incremental(std::span<const char> data, response& resp) {
-    std::string_view data_view{data.data(), data.size()};
-    auto result = detail::parse_http1_response(data_view);
+inline std::expected<response_view, error_code> parser::parse_response_view(std::string_view data) {
+    auto result = detail::parse_http1_response_view(data);
     if (result) {
-        resp = std::move(*result);
-        pimpl_->parse_complete_ = true;
+        detail::stats_add(pimpl_->stats_.responses_parsed);
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    if (result && pimpl_->arena_) {
+        result->reason_phrase = pimpl_->arena_->copy(result->reason_phrase);
+        detail::intern_message_views(*result, *pimpl_->arena_);
+    }
+    return result;
+}
+
+template <detail::fixed_string... Names>
+inline std::expected<request_view, error_code> parser::parse_request_select(std::string_view data) {
+    auto result = detail::parse_http1_request_view_select<Names...>(data);
+    if (result) {
+        detail::stats_add(pimpl_->stats_.requests_parsed);
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    if (result && pimpl_->arena_) {
+        result->uri = pimpl_->arena_->copy(result->uri);
+        detail::intern_message_views(*result, *pimpl_->arena_);
+    }
+    return result;
+}
+
+template <detail::fixed_string... Names>
+inline std::expected<response_view, error_code> parser::parse_response_select(std::string_view data) {
+    auto result = detail::parse_http1_response_view_select<Names...>(data);
+    if (result) {
+        detail::stats_add(pimpl_->stats_.responses_parsed);
+    } else if (result.error() != error_code::need_more_data) {
+        detail::stats_add(pimpl_->stats_.parse_errors);
+    }
+    if (result && pimpl_->arena_) {
+        result->reason_phrase = pimpl_->arena_->copy(result->reason_phrase);
+        detail::intern_message_views(*result, *pimpl_->arena_);
+    }
+    return result;
+}
+
+// =============================================================================
+// Resumable Incremental Parsing
+// =============================================================================
+
+// Extracts the next complete line (without CRLF) starting at `pos`. A line
+// without terminator is stashed in partial_line_ and completed by a later
+// call, so consumed bytes are never scanned twice and continuation chunks
+// may live in different buffers. Returns false when more data is needed.
+inline bool parser::impl::take_line(std::string_view data, size_t& pos, std::string& line) {
+    auto nl = data.find('\n', pos);
+    if (nl == std::string_view::npos) {
+        partial_line_.append(data.substr(pos));
+        pos = data.size();
+        return false;
+    }
+
+    line = std::move(partial_line_);
+    partial_line_.clear();
+    line.append(data.substr(pos, nl - pos));
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    pos = nl + 1;
+    return true;
+}
+
+inline std::expected<void, error_code> parser::impl::parse_start_line(std::string_view line, request& req) {
+    auto [method_str, rest1] = detail::split_first(line, ' ');
+    if (rest1.empty()) {
+        return std::unexpected(error_code::invalid_method);
+    }
+    req.set_method(method_str);
+
+    auto [uri_str, version_str] = detail::split_first(rest1, ' ');
+    if (version_str.empty()) {
+        return std::unexpected(error_code::invalid_uri);
+    }
+    req.uri = uri_str;
+    req.target = uri_str; // For HTTP/2 compatibility
+
+    auto parsed_version = detail::version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
+        return std::unexpected(error_code::invalid_version);
+    }
+    req.protocol_version = *parsed_version;
+    detected_version_ = *parsed_version;
+    return {};
+}
+
+inline std::expected<void, error_code> parser::impl::parse_start_line(std::string_view line, response& resp) {
+    auto [version_str, rest1] = detail::split_first(line, ' ');
+    if (rest1.empty()) {
+        return std::unexpected(error_code::invalid_version);
+    }
+
+    auto parsed_version = detail::version_from_token(version_str);
+    if (!parsed_version || *parsed_version == version::http_2_0) {
+        return std::unexpected(error_code::invalid_version);
+    }
+    resp.protocol_version = *parsed_version;
+    detected_version_ = *parsed_version;
+
+    auto [status_str, reason_str] = detail::split_first(rest1, ' ');
+    uint64_t status = 0;
+    if (!detail::parse_decimal_u64(status_str, status) || status > 999) {
+        return std::unexpected(error_code::protocol_error);
+    }
+    resp.status_code = static_cast<unsigned int>(status);
+
+    if (!reason_str.empty()) {
+        resp.reason_phrase = reason_str;
+    }
+    return {};
+}
+
+// Drives the resumable state machine over one input chunk. Each call
+// consumes only the new bytes and returns how many were taken; an
+// incomplete message is a successful partial consume, not an error. The
+// caller keeps passing the same `msg` until is_parse_complete().
+template <typename Msg>
+inline std::expected<size_t, error_code> parser::impl::parse_http1_incremental(std::span<const char> data, Msg& msg) {
+    std::string_view in{data.data(), data.size()};
+    size_t pos = 0;
+    std::string line;
+
+    if (state_ == parse_state::error) {
+        return std::unexpected(error_code::protocol_error);
+    }
+    if (upgraded_) {
+        // Tunnel passthrough: the bytes belong to the upgraded protocol,
+        // so hand them through untouched - forwarded to the body callback
+        // when one is set - with no state-machine work
+        if (body_cb_ && !data.empty()) {
+            body_cb_(data, false);
+        }
         return data.size();
+    }
+    needs_more_data_ = false;
+
+    auto fail = [&](error_code ec) -> std::expected<size_t, error_code> {
+        state_ = parse_state::error;
+        detail::stats_add(stats_.parse_errors);
+        return std::unexpected(ec);
+    };
+    auto suspend = [&]() -> std::expected<size_t, error_code> {
+        needs_more_data_ = true;
+        return pos;
+    };
+    // Body slices go to the streaming callback when set, otherwise they
+    // accumulate in msg.body; either way they are touched exactly once
+    auto deliver_body = [&](size_t count, bool final) {
+        if (body_cb_) {
+            body_cb_(std::span<const char>(in.data() + pos, count), final);
+        } else {
+            msg.body.append(in.substr(pos, count));
+        }
+        detail::stats_add(stats_.body_bytes, count);
+        pos += count;
+    };
+
+    while (state_ != parse_state::complete) {
+        switch (state_) {
+        case parse_state::start_line: {
+            if (!take_line(in, pos, line)) {
+                return suspend();
+            }
+            if (line.empty()) {
+                break; // Robustness: skip blank lines before the start line
+            }
+            if (auto parsed = parse_start_line(line, msg); !parsed) {
+                return fail(parsed.error());
+            }
+            detail::stats_add(stats_.start_line_bytes, line.size() + 2);
+            state_ = parse_state::headers;
+            break;
+        }
+
+        case parse_state::headers: {
+            if (!take_line(in, pos, line)) {
+                return suspend();
+            }
+            detail::stats_add(stats_.header_bytes, line.size() + 2);
+            if (!line.empty()) {
+                auto [name, value] = detail::split_first(line, ':');
+                if (value.empty()) {
+                    return fail(error_code::invalid_header);
+                }
+                msg.add_header(std::string(detail::trim(name)), std::string(detail::trim(value)));
+                break;
+            }
+
+            // A 101 leaves HTTP entirely: everything past the response head
+            // belongs to the switched-to protocol, so stop consuming here
+            // and flip to passthrough. The returned count marks the
+            // boundary for the caller.
+            if constexpr (std::is_same_v<Msg, response>) {
+                if (msg.status_code == 101) {
+                    upgraded_ = true;
+                    state_ = parse_state::complete;
+                    break;
+                }
+            }
+
+            // Blank line: headers done, pick the body framing
+            auto transfer_encoding = msg.get_header("transfer-encoding");
+            if (transfer_encoding && detail::iequals(detail::trim(*transfer_encoding), "chunked")) {
+                chunked_encoding_ = true;
+                state_ = parse_state::chunk_size;
+            } else if (auto content_length_hdr = msg.get_header("content-length")) {
+                uint64_t content_length = 0;
+                if (!detail::parse_decimal_u64(*content_length_hdr, content_length)) {
+                    return fail(error_code::invalid_header);
+                }
+                content_length_ = content_length;
+                body_bytes_read_ = 0;
+                state_ = content_length_ > 0 ? parse_state::body : parse_state::complete;
+            } else {
+                // No framing information: the message ends with its headers
+                state_ = parse_state::complete;
+            }
+            break;
+        }
+
+        case parse_state::body: {
+            size_t take = std::min(content_length_ - body_bytes_read_, in.size() - pos);
+            body_bytes_read_ += take;
+            deliver_body(take, body_bytes_read_ == content_length_);
+            if (body_bytes_read_ < content_length_) {
+                return suspend();
+            }
+            state_ = parse_state::complete;
+            break;
+        }
+
+        case parse_state::chunk_size: {
+            if (!take_line(in, pos, line)) {
+                return suspend();
+            }
+            auto [size_str, extensions] = detail::split_first(line, ';');
+            uint64_t chunk_size = 0;
+            if (!detail::parse_hex_u64(size_str, chunk_size)) {
+                return fail(error_code::invalid_body);
+            }
+            chunk_remaining_ = chunk_size;
+            state_ = chunk_remaining_ > 0 ? parse_state::chunk_data : parse_state::trailers;
+            break;
+        }
+
+        case parse_state::chunk_data: {
+            size_t take = std::min(chunk_remaining_, in.size() - pos);
+            chunk_remaining_ -= take;
+            deliver_body(take, false);
+            if (chunk_remaining_ > 0) {
+                return suspend();
+            }
+            state_ = parse_state::chunk_data_end;
+            break;
+        }
+
+        case parse_state::chunk_data_end: {
+            if (!take_line(in, pos, line)) {
+                return suspend();
+            }
+            if (!line.empty()) {
+                return fail(error_code::invalid_body);
+            }
+            state_ = parse_state::chunk_size;
+            break;
+        }
+
+        case parse_state::trailers: {
+            if (!take_line(in, pos, line)) {
+                return suspend();
+            }
+            if (line.empty()) {
+                if (body_cb_) {
+                    body_cb_({}, true);
+                }
+                state_ = parse_state::complete;
+            }
+            break;
+        }
+
+        case parse_state::complete:
+        case parse_state::error:
+            break;
+        }
+    }
+
+    parse_complete_ = true;
+    if constexpr (std::is_same_v<Msg, request>) {
+        detail::stats_add(stats_.requests_parsed);
     } else {
-        if (result.error() == error_code::need_more_data) {
-            pimpl_->needs_more_data_ = true;
+        detail::stats_add(stats_.responses_parsed);
+    }
+    return pos;
+}
+
+inline std::expected<size_t, error_code> parser::parse_request_incremental(std::span<const char> data, request& req) {
+    return pimpl_->parse_http1_incremental(data, req);
+}
+
+inline std::expected<size_t, error_code> parser::parse_response_incremental(std::span<const char> data, response& resp) {
+    return pimpl_->parse_http1_incremental(data, resp);
+}
+
+template <typename Reader>
+inline parse_task<std::expected<request, error_code>> parser::async_parse_request(Reader& reader) {
+    pimpl_->reset();
+    request req;
+    while (!pimpl_->parse_complete_) {
+        std::span<const char> chunk = co_await reader;
+        if (chunk.empty()) {
+            co_return std::unexpected(error_code::need_more_data);
+        }
+        if (auto consumed = pimpl_->parse_http1_incremental(chunk, req); !consumed) {
+            co_return std::unexpected(consumed.error());
+        }
+    }
+    co_return req;
+}
+
+template <typename Reader>
+inline parse_task<std::expected<response, error_code>> parser::async_parse_response(Reader& reader) {
+    pimpl_->reset();
+    response resp;
+    while (!pimpl_->parse_complete_) {
+        std::span<const char> chunk = co_await reader;
+        if (chunk.empty()) {
+            co_return std::unexpected(error_code::need_more_data);
+        }
+        if (auto consumed = pimpl_->parse_http1_incremental(chunk, resp); !consumed) {
+            co_return std::unexpected(consumed.error());
         }
-        return std::unexpected(result.error());
     }
+    co_return resp;
 }
 
 // =============================================================================
@@ -532,10 +1258,97 @@ inline std::expected<size_t, error_code> parser::parse_h2_frames(std::span<const
         
         pos += length;
     }
-    
+
     return pos;
 }
 
+inline std::expected<size_t, error_code> parser::parse_h2_frames(std::span<const std::span<const uint8_t>> buffers) {
+    // Frame length is the 24-bit prefix of the 9-byte header
+    auto frame_span_at = [](std::span<const uint8_t> hdr) -> size_t {
+        return 9 + ((static_cast<size_t>(hdr[0]) << 16) |
+                    (static_cast<size_t>(hdr[1]) << 8) |
+                    static_cast<size_t>(hdr[2]));
+    };
+
+    size_t total = 0;
+    size_t i = 0;
+    size_t offset = 0;
+    std::vector<uint8_t> scratch; // Assembles only frames that straddle a boundary
+
+    while (i < buffers.size()) {
+        std::span<const uint8_t> current = buffers[i].subspan(offset);
+        if (current.empty()) {
+            ++i;
+            offset = 0;
+            continue;
+        }
+
+        // Frames lying wholly inside this buffer parse in place
+        size_t prefix = 0;
+        while (prefix + 9 <= current.size() &&
+               prefix + frame_span_at(current.subspan(prefix)) <= current.size()) {
+            prefix += frame_span_at(current.subspan(prefix));
+        }
+        if (prefix > 0) {
+            auto result = parse_h2_frames(current.subspan(0, prefix));
+            if (!result) {
+                return result;
+            }
+            total += *result;
+            offset += prefix;
+            continue;
+        }
+
+        // The next frame straddles the buffer boundary: peek its header
+        // across buffers, then assemble exactly that one frame
+        uint8_t header_bytes[9];
+        size_t have = std::min(current.size(), sizeof(header_bytes));
+        std::memcpy(header_bytes, current.data(), have);
+        for (size_t j = i + 1; have < sizeof(header_bytes) && j < buffers.size(); ++j) {
+            size_t take = std::min(sizeof(header_bytes) - have, buffers[j].size());
+            std::memcpy(header_bytes + have, buffers[j].data(), take);
+            have += take;
+        }
+        if (have < sizeof(header_bytes)) {
+            return std::unexpected(error_code::need_more_data);
+        }
+
+        size_t frame_total = frame_span_at(header_bytes);
+        scratch.clear();
+        scratch.reserve(frame_total);
+        scratch.insert(scratch.end(), current.begin(), current.end());
+        for (size_t j = i + 1; scratch.size() < frame_total && j < buffers.size(); ++j) {
+            size_t take = std::min(frame_total - scratch.size(), buffers[j].size());
+            scratch.insert(scratch.end(), buffers[j].begin(), buffers[j].begin() + take);
+        }
+        if (scratch.size() < frame_total) {
+            return std::unexpected(error_code::need_more_data);
+        }
+
+        auto result = parse_h2_frames(std::span<const uint8_t>(scratch));
+        if (!result) {
+            return result;
+        }
+        total += frame_total;
+
+        // Advance past the assembled frame across the buffer list
+        size_t remaining_skip = frame_total - current.size();
+        ++i;
+        offset = 0;
+        while (remaining_skip > 0) {
+            size_t take = std::min(remaining_skip, buffers[i].size() - offset);
+            offset += take;
+            remaining_skip -= take;
+            if (remaining_skip > 0) {
+                ++i;
+                offset = 0;
+            }
+        }
+    }
+
+    return total;
+}
+
 inline std::expected<size_t, error_code> parser::parse_h2_preface(std::span<const uint8_t> data) {
     // HTTP/2 connection preface: "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
     const std::string_view preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define HTTP_PARSE_SCAN_SSE2 1
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HTTP_PARSE_SCAN_NEON 1
+#endif
+
+namespace co::http::detail {
+
+// =============================================================================
+// Vectorized Scanning Kernels
+//
+// Hot-path byte scanning for the HTTP/1 parser: locating CRLF line
+// boundaries and single-byte delimiters (':', ' ') 16-32 bytes at a time.
+// x86-64 always has SSE2; AVX2 is selected at runtime when available.
+// AArch64 uses NEON. Everything else falls back to the scalar path.
+// =============================================================================
+
+namespace scan {
+
+inline size_t find_byte_scalar(const char* data, size_t size, char target) noexcept {
+    const void* p = std::memchr(data, target, size);
+    return p ? static_cast<size_t>(static_cast<const char*>(p) - data) : size;
+}
+
+#if defined(HTTP_PARSE_SCAN_SSE2)
+
+inline size_t find_byte_sse2(const char* data, size_t size, char target) noexcept {
+    const __m128i needle = _mm_set1_epi8(target);
+    size_t pos = 0;
+    while (pos + 16 <= size) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+        pos += 16;
+    }
+    if (pos < size) {
+        size_t rest = find_byte_scalar(data + pos, size - pos, target);
+        return rest == size - pos ? size : pos + rest;
+    }
+    return size;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define HTTP_PARSE_SCAN_AVX2 1
+
+__attribute__((target("avx2")))
+inline size_t find_byte_avx2(const char* data, size_t size, char target) noexcept {
+    const __m256i needle = _mm256_set1_epi8(target);
+    size_t pos = 0;
+    while (pos + 32 <= size) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+        pos += 32;
+    }
+    if (pos < size) {
+        size_t rest = find_byte_sse2(data + pos, size - pos, target);
+        return rest == size - pos ? size : pos + rest;
+    }
+    return size;
+}
+#endif
+
+#elif defined(HTTP_PARSE_SCAN_NEON)
+
+inline size_t find_byte_neon(const char* data, size_t size, char target) noexcept {
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(target));
+    size_t pos = 0;
+    while (pos + 16 <= size) {
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+        uint8x16_t eq = vceqq_u8(block, needle);
+        // Narrow each 8-bit lane to 4 bits so the match mask fits in 64 bits
+        uint64_t mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctzll(mask)) / 4;
+        }
+        pos += 16;
+    }
+    if (pos < size) {
+        size_t rest = find_byte_scalar(data + pos, size - pos, target);
+        return rest == size - pos ? size : pos + rest;
+    }
+    return size;
+}
+
+#endif
+
+using find_byte_fn = size_t (*)(const char*, size_t, char) noexcept;
+
+inline find_byte_fn select_find_byte() noexcept {
+#if defined(HTTP_PARSE_SCAN_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        return &find_byte_avx2;
+    }
+#endif
+#if defined(HTTP_PARSE_SCAN_SSE2)
+    return &find_byte_sse2;
+#elif defined(HTTP_PARSE_SCAN_NEON)
+    return &find_byte_neon;
+#else
+    return &find_byte_scalar;
+#endif
+}
+
+// Resolved once per process; subsequent calls are a single indirect call
+inline size_t find_byte(const char* data, size_t size, char target) noexcept {
+    static const find_byte_fn fn = select_find_byte();
+    return fn(data, size, target);
+}
+
+} // namespace scan
+
+// Position of `target` in `str` at or after `from`, or npos
+inline size_t find_char(std::string_view str, char target, size_t from = 0) noexcept {
+    while (from < str.size()) {
+        size_t pos = scan::find_byte(str.data() + from, str.size() - from, target);
+        if (pos == str.size() - from) {
+            return std::string_view::npos;
+        }
+        return from + pos;
+    }
+    return std::string_view::npos;
+}
+
+// =============================================================================
+// SWAR Case-Insensitive Comparison
+// =============================================================================
+
+// Folds ASCII 'A'..'Z' to lowercase across 8 bytes at once. Only bytes that
+// really are uppercase letters receive the 0x20 bit - digits, '-', '@' and
+// non-ASCII bytes pass through untouched, so blindly ORing 0x20 cannot
+// produce false matches (e.g. '@' vs '`').
+inline uint64_t ascii_tolower_word(uint64_t word) noexcept {
+    constexpr uint64_t ones = 0x0101010101010101ull;
+    constexpr uint64_t high = 0x8080808080808080ull;
+    uint64_t heptets = word & ~high;
+    uint64_t ge_upper_a = heptets + (0x80 - 'A') * ones;     // bit 7: byte >= 'A'
+    uint64_t gt_upper_z = heptets + (0x80 - 'Z' - 1) * ones; // bit 7: byte > 'Z'
+    uint64_t is_upper = ge_upper_a & ~gt_upper_z & ~word & high;
+    return word | (is_upper >> 2); // 0x80 >> 2 == 0x20
+}
+
+// Case-insensitive ASCII equality, one word per step. Header names are
+// almost always <= 24 bytes, so a lookup is 1-3 word compares instead of a
+// per-character tolower loop.
+inline bool iequals_ascii(std::string_view a, std::string_view b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    const char* pa = a.data();
+    const char* pb = b.data();
+    size_t remaining = a.size();
+    while (remaining >= 8) {
+        uint64_t wa;
+        uint64_t wb;
+        std::memcpy(&wa, pa, 8);
+        std::memcpy(&wb, pb, 8);
+        if (ascii_tolower_word(wa) != ascii_tolower_word(wb)) {
+            return false;
+        }
+        pa += 8;
+        pb += 8;
+        remaining -= 8;
+    }
+    if (remaining > 0) {
+        uint64_t wa = 0;
+        uint64_t wb = 0;
+        std::memcpy(&wa, pa, remaining);
+        std::memcpy(&wb, pb, remaining);
+        if (ascii_tolower_word(wa) != ascii_tolower_word(wb)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Case-insensitive FNV-1a over a header name. Folding by blindly setting
+// bit 5 maps '@'/'`' (and friends) to the same bucket, which is fine for
+// hashing - equality is always re-verified with iequals_ascii.
+inline uint32_t iname_hash(std::string_view name) noexcept {
+    uint32_t h = 2166136261u;
+    for (unsigned char c : name) {
+        h = (h ^ (c | 0x20u)) * 16777619u;
+    }
+    return h;
+}
+
+// =============================================================================
+// Integer Formatting / Parsing Kernels
+// =============================================================================
+//
+// Content-Length, status codes and chunk sizes are converted once or more
+// per message, and the generic to_chars/from_chars machinery (base dispatch,
+// sign handling, full overflow bookkeeping) is overkill for them. These
+// kernels know the wire format: unsigned, bounded length, decimal or hex.
+
+// "00".."99" packed as byte pairs so decimal formatting emits two digits
+// per store
+inline constexpr auto decimal_digit_pairs = [] {
+    std::array<char, 200> table{};
+    for (int i = 0; i < 100; ++i) {
+        table[static_cast<size_t>(i) * 2] = static_cast<char>('0' + i / 10);
+        table[static_cast<size_t>(i) * 2 + 1] = static_cast<char>('0' + i % 10);
+    }
+    return table;
+}();
+
+inline unsigned decimal_digit_count(uint64_t value) noexcept {
+    unsigned digits = 1;
+    while (value >= 10000) {
+        value /= 10000;
+        digits += 4;
+    }
+    return digits + (value >= 10) + (value >= 100) + (value >= 1000);
+}
+
+// Unsigned decimal itoa, two digits per step from the lookup table.
+// Returns one past the last byte written; the caller provides at least
+// 20 bytes.
+inline char* format_decimal(char* out, uint64_t value) noexcept {
+    char* end = out + decimal_digit_count(value);
+    char* p = end;
+    while (value >= 100) {
+        uint64_t pair = value % 100;
+        value /= 100;
+        p -= 2;
+        std::memcpy(p, &decimal_digit_pairs[pair * 2], 2);
+    }
+    if (value >= 10) {
+        p -= 2;
+        std::memcpy(p, &decimal_digit_pairs[value * 2], 2);
+    } else {
+        *--p = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+// Lowercase hex itoa without leading zeros (chunk-size lines). Returns one
+// past the last byte written; the caller provides at least 16 bytes.
+inline char* format_hex(char* out, uint64_t value) noexcept {
+    constexpr char digits[] = "0123456789abcdef";
+    if (value == 0) {
+        *out++ = '0';
+        return out;
+    }
+    int nibbles = (64 - std::countl_zero(value) + 3) / 4;
+    for (int i = nibbles - 1; i >= 0; --i) {
+        *out++ = digits[(value >> (i * 4)) & 0xF];
+    }
+    return out;
+}
+
+// Unsigned decimal atoi over the whole view; false on empty input, any
+// non-digit byte, or a length that could overflow uint64_t. Validity is
+// accumulated across the loop instead of branching per character.
+inline bool parse_decimal_u64(std::string_view str, uint64_t& out) noexcept {
+    if (str.empty() || str.size() > 19) {
+        return false;
+    }
+    uint64_t value = 0;
+    uint32_t bad = 0;
+    for (unsigned char c : str) {
+        uint32_t digit = static_cast<uint32_t>(c) - '0';
+        bad |= static_cast<uint32_t>(digit > 9);
+        value = value * 10 + digit;
+    }
+    if (bad != 0) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+// Nibble values for hex parsing; invalid bytes map to 0xFF so one OR over
+// the loop detects them without per-character branches
+inline constexpr auto hex_nibble_table = [] {
+    std::array<uint8_t, 256> table{};
+    table.fill(0xFF);
+    for (int i = 0; i <= 9; ++i) {
+        table[static_cast<size_t>('0') + i] = static_cast<uint8_t>(i);
+    }
+    for (int i = 0; i < 6; ++i) {
+        table[static_cast<size_t>('a') + i] = static_cast<uint8_t>(10 + i);
+        table[static_cast<size_t>('A') + i] = static_cast<uint8_t>(10 + i);
+    }
+    return table;
+}();
+
+// Unsigned hex atoi over the whole view (chunk-size lines); false on empty
+// input, any non-hex byte, or more than 16 digits
+inline bool parse_hex_u64(std::string_view str, uint64_t& out) noexcept {
+    if (str.empty() || str.size() > 16) {
+        return false;
+    }
+    uint64_t value = 0;
+    uint8_t bad = 0;
+    for (unsigned char c : str) {
+        uint8_t nibble = hex_nibble_table[c];
+        bad |= nibble;
+        value = (value << 4) | (nibble & 0x0F);
+    }
+    if ((bad & 0xF0) != 0) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+// Position of the next "\r\n" in `str` at or after `from`, or npos.
+// Scans for '\r' vectorized and confirms the following '\n'.
+inline size_t find_crlf(std::string_view str, size_t from = 0) noexcept {
+    while (from + 1 < str.size()) {
+        size_t pos = find_char(str, '\r', from);
+        if (pos == std::string_view::npos || pos + 1 >= str.size()) {
+            return std::string_view::npos;
+        }
+        if (str[pos + 1] == '\n') {
+            return pos;
+        }
+        from = pos + 1;
+    }
+    return std::string_view::npos;
+}
+
+} // namespace co::http::detail
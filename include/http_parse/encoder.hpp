@@ -9,6 +9,99 @@
 
 namespace co::http {
 
+// =============================================================================
+// Pre-Serialized Response Template
+// =============================================================================
+
+// Compiles a response skeleton (status line + fixed headers) once into an
+// immutable byte blob, so repeated responses with the same prefix reduce to
+// a memcpy plus patching the Content-Length slot and appending the body.
+// Any Content-Length header on the skeleton is dropped - it is always
+// stamped from the actual body size at encode time. The skeleton's body is
+// ignored.
+class response_template {
+public:
+    response_template() = default;
+    explicit response_template(const response& skeleton);
+
+    // Size of the pre-serialized prefix in bytes (excludes the patch slots)
+    size_t prefix_size() const noexcept { return head_.size() + mid_.size(); }
+
+    // True when the skeleton carried no Date header, so encoding stamps the
+    // cached date (see encoder::cached_date) into the reserved slot
+    bool has_date_slot() const noexcept { return date_slot_; }
+
+private:
+    friend class encoder;
+
+    // Pre-serialized bytes around the patch slots. With a Date slot the
+    // prefix ends with "Date: " and mid_ carries "\r\nContent-Length: ";
+    // without one mid_ is empty and the prefix ends with "Content-Length: ".
+    // Either way the encoder only appends the slot values, the blank line
+    // and the body.
+    std::string head_;
+    std::string mid_;
+    bool date_slot_ = false;
+};
+
+// =============================================================================
+// Streaming Body Framing
+// =============================================================================
+
+// Frames a body that never enters user space. Instead of staging payload in
+// message::body, the caller asks for one slice at a time: next(available)
+// returns the framing bytes to write before and after the next `payload`
+// bytes, which the caller then moves with sendfile/splice (or writev from
+// its own buffers). Framing views point into a small fixed buffer inside
+// the stream and stay valid until the next call on the same stream.
+class body_stream {
+public:
+    // One framed slice: write prefix, then `payload` bytes from the
+    // caller's source, then suffix
+    struct frame {
+        std::string_view prefix;
+        size_t payload = 0;
+        std::string_view suffix;
+    };
+
+    // HTTP/1.1 Transfer-Encoding: chunked (each slice becomes one chunk)
+    static body_stream chunked() noexcept;
+
+    // HTTP/1.x Content-Length body: no per-slice framing, but payload is
+    // clamped to the declared length so the caller cannot overrun it
+    static body_stream content_length(uint64_t total) noexcept;
+
+    // HTTP/2 DATA framing for one stream; each slice is capped at
+    // max_frame_size, so callers offering larger windows get them split
+    // across calls
+    static body_stream h2_data(uint32_t stream_id, uint32_t max_frame_size = 16384) noexcept;
+
+    // Frames up to `available` payload bytes (zero payload after the body
+    // is exhausted or finish() was called)
+    frame next(uint64_t available) noexcept;
+
+    // Terminator bytes after the last payload slice: the last-chunk for
+    // chunked mode, an empty END_STREAM DATA frame for HTTP/2, nothing for
+    // content-length. Idempotent
+    std::string_view finish() noexcept;
+
+    uint64_t bytes_framed() const noexcept { return framed_; }
+    bool finished() const noexcept { return finished_; }
+
+private:
+    enum class framing_mode : uint8_t { chunked, content_length, h2_data };
+
+    explicit body_stream(framing_mode mode) noexcept : mode_(mode) {}
+
+    framing_mode mode_;
+    bool finished_ = false;
+    uint64_t remaining_ = 0;     // content_length mode only
+    uint64_t framed_ = 0;
+    uint32_t stream_id_ = 0;     // h2_data mode only
+    uint32_t max_frame_size_ = 0;
+    char framing_[24];           // chunk-size line or 9-byte frame header
+};
+
 // =============================================================================
 // Unified Encoder Interface
 // =============================================================================
@@ -35,6 +128,12 @@ public:
     // High-performance encoding to buffer
     std::expected<size_t, error_code> encode_request(const request& req, output_buffer& output);
     std::expected<size_t, error_code> encode_response(const response& resp, output_buffer& output);
+
+    // Stamps a compiled template: copies the pre-serialized prefix, patches
+    // Content-Length from body.size() and appends the body. Much cheaper
+    // than encode_response when the same prefix is emitted repeatedly.
+    std::expected<size_t, error_code> encode_from_template(const response_template& tmpl,
+                                                           std::string_view body, output_buffer& output);
     
     // =============================================================================
     // HTTP/2 Encoding Interface
@@ -84,6 +183,12 @@ public:
     // Performance tuning
     void set_max_frame_size(uint32_t size);
     uint32_t get_max_frame_size() const noexcept;
+
+    // RFC 7231 IMF-fixdate ("Sun, 06 Nov 1994 08:49:37 GMT") for the current
+    // time, re-formatted at most once per second per thread. The returned
+    // 29-character view stays valid for the calling thread. encode_response
+    // stamps it automatically when the message lacks a Date header.
+    static std::string_view cached_date();
     
 private:
     class impl;
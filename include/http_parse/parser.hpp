@@ -1,6 +1,9 @@
 #pragma once
 
+#include "arena.hpp"
 #include "core.hpp"
+#include "coro.hpp"
+#include "detail/fixed_string.hpp"
 #include "v1/parser.hpp"
 #include "v2/parser.hpp"
 #include <memory>
@@ -15,6 +18,13 @@ namespace co::http {
 class parser {
 public:
     explicit parser(version ver = version::auto_detect);
+
+    // Arena-backed parser: all view storage produced by parse_request_view/
+    // parse_response_view is copied into `arena`, so the views stay valid
+    // after the input buffer is reused. The arena must outlive the parser;
+    // call arena.reset() between keep-alive requests to reclaim storage.
+    parser(version ver, message_arena& arena);
+
     ~parser();
     
     // Non-copyable, movable
@@ -30,16 +40,93 @@ public:
     // Parse complete messages
     std::expected<request, error_code> parse_request(std::string_view data);
     std::expected<response, error_code> parse_response(std::string_view data);
+
+    // Zero-copy parsing: the returned views point into `data`, which must
+    // outlive the result. No per-header string copies are made.
+    std::expected<request_view, error_code> parse_request_view(std::string_view data);
+    std::expected<response_view, error_code> parse_response_view(std::string_view data);
+
+    // Selective zero-copy parsing: only the headers named as template
+    // arguments are stored, e.g.
+    //     p.parse_request_select<"host", "x-route-key">(data);
+    // The matcher is compiled per name list (an unrolled fold of word-at-a-
+    // time compares - cheaper than hashing for the handful of names a router
+    // cares about), and everything else skips header storage entirely.
+    // Content-Length still frames the body even when it is not selected.
+    template <detail::fixed_string... Names>
+    std::expected<request_view, error_code> parse_request_select(std::string_view data);
+    template <detail::fixed_string... Names>
+    std::expected<response_view, error_code> parse_response_select(std::string_view data);
     
-    // Incremental parsing
+    // Incremental parsing: resumable across calls, each of which consumes
+    // only the new bytes and returns how many were taken (a partial message
+    // is not an error). Chunks do not have to be contiguous - partial lines
+    // are carried over internally. Keep passing the same message object
+    // until is_parse_complete(); call reset() before the next message.
     std::expected<size_t, error_code> parse_request_incremental(std::span<const char> data, request& req);
     std::expected<size_t, error_code> parse_response_incremental(std::span<const char> data, response& resp);
     
+    // Streaming body delivery. When a body callback is set, parse_request/
+    // parse_response and the incremental paths no longer copy the body into
+    // message::body (it is left empty); instead the callback receives
+    // zero-copy slices of the input buffer. Content-length bodies arrive as
+    // one slice; chunked bodies are decoded and delivered chunk by chunk.
+    // `final` is true once the body is complete.
+    using body_callback = std::function<void(std::span<const char> data, bool final)>;
+    void set_body_callback(body_callback callback);
+
+    // Coroutine parsing: awaits input chunks from `reader` - any awaitable
+    // yielding std::span<const char>, where an empty span means end of
+    // input - and feeds them through the resumable incremental machine. The
+    // task is lazy (nothing runs until awaited or resumed) and suspensions
+    // allocate nothing beyond the coroutine frame. Bytes in the final chunk
+    // past the end of the message are left unconsumed in the machine;
+    // pipelining callers should use the incremental interface directly.
+    template <typename Reader>
+    parse_task<std::expected<request, error_code>> async_parse_request(Reader& reader);
+    template <typename Reader>
+    parse_task<std::expected<response, error_code>> async_parse_response(Reader& reader);
+
     // Parsing state
     bool is_parse_complete() const noexcept;
     bool needs_more_data() const noexcept;
     version detected_version() const noexcept;
+
+    // Discards per-message parse state so the parser can take the next
+    // message. Guaranteed O(1): fixed-size state is reassigned and internal
+    // buffers (partial-line carry, HPACK tables) keep their grown capacity,
+    // so a reused parser does not reallocate for workloads it has already
+    // seen. Callbacks, arena binding and stats are untouched (see pool.hpp
+    // for the pooled reuse pattern built on this guarantee).
     void reset() noexcept;
+
+    // Upgrade/tunnel passthrough. When a "101 Switching Protocols" response
+    // head completes, the parser stops consuming - the count returned by
+    // parse_response_incremental marks the boundary, so bytes past it
+    // already belong to the tunneled protocol. From then on the incremental
+    // entry points hand input through as opaque spans with no state-machine
+    // work: the whole span is reported consumed and forwarded to the body
+    // callback when one is set. Proxies that establish a tunnel themselves
+    // (a 2xx reply to CONNECT) force the switch with enter_tunnel_mode().
+    // reset() leaves tunnel mode.
+    bool is_upgraded() const noexcept;
+    void enter_tunnel_mode() noexcept;
+
+    // Instrumentation counters (all zero when built with
+    // HTTP_PARSE_DISABLE_STATS). The byte counters split successfully parsed
+    // input by message section, so a skewed ratio points at where parse time
+    // goes. need_more_data is not counted as a parse error.
+    struct stats {
+        uint64_t requests_parsed = 0;
+        uint64_t responses_parsed = 0;
+        uint64_t start_line_bytes = 0;
+        uint64_t header_bytes = 0;
+        uint64_t body_bytes = 0;
+        uint64_t parse_errors = 0;
+    };
+
+    const stats& get_stats() const noexcept;
+    void reset_stats() noexcept;
     
     // =============================================================================
     // HTTP/2 Parsing Interface
@@ -67,6 +154,12 @@ public:
     
     // Parse HTTP/2 frames
     std::expected<size_t, error_code> parse_h2_frames(std::span<const uint8_t> data);
+
+    // Vectored variant for readv-style ingestion: frames lying wholly inside
+    // one buffer parse in place, and only a frame that straddles a buffer
+    // boundary is assembled into a scratch buffer - no staging copy of the
+    // whole read
+    std::expected<size_t, error_code> parse_h2_frames(std::span<const std::span<const uint8_t>> buffers);
     
     // Parse connection preface
     std::expected<size_t, error_code> parse_h2_preface(std::span<const uint8_t> data);
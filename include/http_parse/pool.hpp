@@ -0,0 +1,150 @@
+#pragma once
+
+#include "encoder.hpp"
+#include "parser.hpp"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace co::http {
+
+// =============================================================================
+// Parser / Encoder Pooling
+// =============================================================================
+
+// Recycles movable instances through RAII handles. Constructing a parser
+// allocates its impl and drags cold HPACK tables along, so services that
+// want a "fresh" instance per request should acquire from a pool instead:
+// a recycled instance is reset in O(1) and keeps its warmed-up buffer
+// capacity. Pools are not thread-safe - use one per thread (see
+// parser_pool::local / encoder_pool::local).
+template <typename T>
+class object_pool {
+public:
+    // Owns one pooled instance; returns it to the pool on destruction
+    class handle {
+    public:
+        handle() = default;
+
+        handle(handle&& other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)), obj_(std::move(other.obj_)) {
+            other.obj_.reset();
+        }
+
+        handle& operator=(handle&& other) noexcept {
+            if (this != &other) {
+                put_back();
+                pool_ = std::exchange(other.pool_, nullptr);
+                obj_ = std::move(other.obj_);
+                other.obj_.reset();
+            }
+            return *this;
+        }
+
+        handle(const handle&) = delete;
+        handle& operator=(const handle&) = delete;
+
+        ~handle() { put_back(); }
+
+        T& operator*() noexcept { return *obj_; }
+        const T& operator*() const noexcept { return *obj_; }
+        T* operator->() noexcept { return &*obj_; }
+        const T* operator->() const noexcept { return &*obj_; }
+
+    private:
+        friend class object_pool;
+
+        handle(object_pool* pool, T&& obj) : pool_(pool), obj_(std::move(obj)) {}
+
+        void put_back() {
+            if (pool_ != nullptr && obj_.has_value()) {
+                pool_->release(std::move(*obj_));
+            }
+            pool_ = nullptr;
+            obj_.reset();
+        }
+
+        object_pool* pool_ = nullptr;
+        std::optional<T> obj_;
+    };
+
+    explicit object_pool(std::function<T()> make) : make_(std::move(make)) {}
+
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+
+    // Hands out an idle instance (reset, buffers retained) or constructs a
+    // new one when the pool is empty
+    handle acquire() {
+        if (!idle_.empty()) {
+            T obj = std::move(idle_.back());
+            idle_.pop_back();
+            if constexpr (requires(T& t) { t.reset(); }) {
+                obj.reset();
+            }
+            return handle(this, std::move(obj));
+        }
+        return handle(this, make_());
+    }
+
+    size_t idle_count() const noexcept { return idle_.size(); }
+
+private:
+    friend class handle;
+
+    void release(T&& obj) { idle_.push_back(std::move(obj)); }
+
+    std::function<T()> make_;
+    std::vector<T> idle_;
+};
+
+// Pool of parsers sharing one protocol version. Reuse semantics: reset()
+// clears all per-message parse state before hand-out, while configuration
+// (callbacks, arena binding, HTTP/2 limits) and accumulated stats stay with
+// the instance - set callbacks once per thread, not per request.
+class parser_pool {
+public:
+    using handle = object_pool<parser>::handle;
+
+    explicit parser_pool(version ver = version::auto_detect)
+        : pool_([ver] { return parser(ver); }) {}
+
+    handle acquire() { return pool_.acquire(); }
+    size_t idle_count() const noexcept { return pool_.idle_count(); }
+
+    // The calling thread's pool (auto-detect version); the per-request
+    // acquire/parse/release cycle then allocates only on first use
+    static parser_pool& local() {
+        thread_local parser_pool pool;
+        return pool;
+    }
+
+private:
+    object_pool<parser> pool_;
+};
+
+// Pool of encoders. Encoding is stateless per call apart from the HPACK
+// dynamic table, which belongs to a connection - do not share one pooled
+// encoder across HTTP/2 connections mid-stream.
+class encoder_pool {
+public:
+    using handle = object_pool<encoder>::handle;
+
+    explicit encoder_pool(version ver = version::http_1_1)
+        : pool_([ver] { return encoder(ver); }) {}
+
+    handle acquire() { return pool_.acquire(); }
+    size_t idle_count() const noexcept { return pool_.idle_count(); }
+
+    static encoder_pool& local() {
+        thread_local encoder_pool pool;
+        return pool;
+    }
+
+private:
+    object_pool<encoder> pool_;
+};
+
+} // namespace co::http
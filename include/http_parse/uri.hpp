@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace co::http {
+
+// =============================================================================
+// Lazy URI Component Views
+// =============================================================================
+
+// Percent-decodes `encoded` (and '+' as space when `plus_as_space` is set,
+// for form-encoded query values). The input view itself is returned when it
+// contains nothing to decode, so the common already-plain case costs one
+// scan and zero allocation; only when a decoded octet is actually present is
+// the result materialized into `scratch`. Malformed escapes ("%G1", a
+// truncated "%4") are passed through literally rather than rejected.
+inline std::string_view percent_decode(std::string_view encoded,
+                                       std::string& scratch,
+                                       bool plus_as_space = false) {
+    auto needs_decode = [plus_as_space](char c) {
+        return c == '%' || (plus_as_space && c == '+');
+    };
+
+    size_t first = 0;
+    while (first < encoded.size() && !needs_decode(encoded[first])) {
+        ++first;
+    }
+    if (first == encoded.size()) {
+        return encoded;
+    }
+
+    auto hex_digit = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+
+    scratch.assign(encoded.substr(0, first));
+    scratch.reserve(encoded.size());
+    for (size_t i = first; i < encoded.size(); ++i) {
+        char c = encoded[i];
+        if (c == '+' && plus_as_space) {
+            scratch.push_back(' ');
+        } else if (c == '%' && i + 2 < encoded.size()) {
+            int hi = hex_digit(encoded[i + 1]);
+            int lo = hex_digit(encoded[i + 2]);
+            if (hi >= 0 && lo >= 0) {
+                scratch.push_back(static_cast<char>((hi << 4) | lo));
+                i += 2;
+            } else {
+                scratch.push_back(c);
+            }
+        } else {
+            scratch.push_back(c);
+        }
+    }
+    return scratch;
+}
+
+// Zero-copy view over a request target such as "/users?id=7&lang=en#top".
+// Components are located once, on first access, and returned as views into
+// the original string - constructing a uri_view does no work, so storing one
+// per request taxes nothing when routing never looks at it. The target must
+// outlive the view.
+class uri_view {
+public:
+    uri_view() = default;
+    explicit uri_view(std::string_view target) noexcept : target_(target) {}
+
+    // The unparsed target as received
+    std::string_view raw() const noexcept { return target_; }
+
+    // Path up to the first '?' or '#'
+    std::string_view path() const noexcept {
+        split();
+        return target_.substr(0, path_end_);
+    }
+
+    // Query between '?' and '#', without the '?'
+    std::string_view query() const noexcept {
+        split();
+        return target_.substr(query_begin_, query_end_ - query_begin_);
+    }
+
+    // Fragment after '#', without the '#'
+    std::string_view fragment() const noexcept {
+        split();
+        return target_.substr(fragment_begin_);
+    }
+
+    bool has_query() const noexcept {
+        split();
+        return query_begin_ != query_end_;
+    }
+
+    bool has_fragment() const noexcept {
+        split();
+        return fragment_begin_ != target_.size();
+    }
+
+    // One key/value pair of the query string; both views point into the
+    // original target and stay percent-encoded (decode with percent_decode
+    // only where a handler actually needs the plain text)
+    struct query_param {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    // Walks "k1=v1&k2&k3=" without allocating. A segment without '=' yields
+    // an empty value; empty segments ("a&&b") are skipped.
+    class query_param_iterator {
+    public:
+        query_param_iterator() = default; // end iterator
+        explicit query_param_iterator(std::string_view rest)
+            : rest_(rest), done_(false) {
+            advance();
+        }
+
+        const query_param& operator*() const noexcept { return current_; }
+        const query_param* operator->() const noexcept { return &current_; }
+
+        query_param_iterator& operator++() {
+            advance();
+            return *this;
+        }
+
+        friend bool operator==(const query_param_iterator& a,
+                               const query_param_iterator& b) noexcept {
+            return a.done_ == b.done_;
+        }
+
+    private:
+        void advance() {
+            while (!rest_.empty()) {
+                size_t amp = rest_.find('&');
+                std::string_view segment = rest_.substr(0, amp);
+                rest_ = amp == std::string_view::npos
+                            ? std::string_view{}
+                            : rest_.substr(amp + 1);
+                if (segment.empty()) {
+                    continue; // Skip "a&&b" style empties
+                }
+                size_t eq = segment.find('=');
+                current_.key = segment.substr(0, eq);
+                current_.value = eq == std::string_view::npos
+                                     ? std::string_view{}
+                                     : segment.substr(eq + 1);
+                return;
+            }
+            done_ = true;
+        }
+
+        std::string_view rest_{};
+        query_param current_{};
+        bool done_ = true;
+    };
+
+    struct query_param_range {
+        std::string_view query;
+        query_param_iterator begin() const { return query_param_iterator(query); }
+        query_param_iterator end() const { return query_param_iterator(); }
+    };
+
+    query_param_range query_params() const noexcept { return {query()}; }
+
+    // First value for `key` in the query, still percent-encoded, or nullopt.
+    // Key comparison is exact (query keys are case-sensitive per RFC 3986).
+    std::optional<std::string_view> query_param_value(std::string_view key) const noexcept {
+        for (const auto& param : query_params()) {
+            if (param.key == key) {
+                return param.value;
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    // Locates the component boundaries once; '#' wins over '?' so a '?'
+    // inside the fragment is not mistaken for a query
+    void split() const noexcept {
+        if (split_) {
+            return;
+        }
+        size_t hash = target_.find('#');
+        size_t before_fragment = hash == std::string_view::npos ? target_.size() : hash;
+        fragment_begin_ = hash == std::string_view::npos ? target_.size() : hash + 1;
+
+        size_t qmark = target_.substr(0, before_fragment).find('?');
+        if (qmark == std::string_view::npos) {
+            path_end_ = before_fragment;
+            query_begin_ = query_end_ = before_fragment;
+        } else {
+            path_end_ = qmark;
+            query_begin_ = qmark + 1;
+            query_end_ = before_fragment;
+        }
+        split_ = true;
+    }
+
+    std::string_view target_{};
+    mutable size_t path_end_ = 0;
+    mutable size_t query_begin_ = 0;
+    mutable size_t query_end_ = 0;
+    mutable size_t fragment_begin_ = 0;
+    mutable bool split_ = false;
+};
+
+} // namespace co::http
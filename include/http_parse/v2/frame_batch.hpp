@@ -0,0 +1,158 @@
+#pragma once
+
+#include "types.hpp"
+#include "../arena.hpp"
+#include <cstring>
+#include <sys/uio.h>
+#include <vector>
+
+namespace co::http::v2 {
+
+// =============================================================================
+// HTTP/2 Frame Batch (Scatter-Gather Egress)
+// =============================================================================
+
+// Records a flight of outbound frames as an iovec list for writev/sendmsg.
+// Frame headers (and the few bytes of control-frame payloads) are serialized
+// into an internal arena with stable addresses; DATA and header-block
+// payloads stay caller-owned and are referenced in place, so body bytes are
+// never copied. Payload storage must outlive the writev call.
+class frame_batch {
+public:
+    frame_batch() = default;
+
+    // Non-copyable, movable
+    frame_batch(const frame_batch&) = delete;
+    frame_batch& operator=(const frame_batch&) = delete;
+    frame_batch(frame_batch&&) = default;
+    frame_batch& operator=(frame_batch&&) = default;
+
+    // =============================================================================
+    // Frame Recording
+    // =============================================================================
+
+    // DATA frame; `payload` is referenced, not copied
+    void add_data_frame(uint32_t stream_id, std::span<const uint8_t> payload, bool end_stream) {
+        uint8_t flags = end_stream ? static_cast<uint8_t>(frame_flags::end_stream) : 0;
+        add_header(static_cast<uint32_t>(payload.size()), frame_type::data, flags, stream_id);
+        add_external(payload);
+    }
+
+    // HEADERS frame over an already HPACK-encoded header block (e.g. from
+    // hpack_encoder::encode_headers); the block is referenced, not copied
+    void add_headers_frame(uint32_t stream_id, std::span<const uint8_t> header_block,
+                           bool end_stream, bool end_headers) {
+        uint8_t flags = 0;
+        if (end_stream) flags |= static_cast<uint8_t>(frame_flags::end_stream);
+        if (end_headers) flags |= static_cast<uint8_t>(frame_flags::end_headers);
+        add_header(static_cast<uint32_t>(header_block.size()), frame_type::headers, flags, stream_id);
+        add_external(header_block);
+    }
+
+    // CONTINUATION frame; the fragment is referenced, not copied
+    void add_continuation_frame(uint32_t stream_id, std::span<const uint8_t> header_block_fragment,
+                                bool end_headers) {
+        uint8_t flags = end_headers ? static_cast<uint8_t>(frame_flags::end_headers) : 0;
+        add_header(static_cast<uint32_t>(header_block_fragment.size()), frame_type::continuation,
+                   flags, stream_id);
+        add_external(header_block_fragment);
+    }
+
+    // WINDOW_UPDATE frame (payload lives in the arena)
+    void add_window_update_frame(uint32_t stream_id, uint32_t window_size_increment) {
+        add_header(4, frame_type::window_update, 0, stream_id);
+        uint8_t* p = reinterpret_cast<uint8_t*>(arena_.allocate(4));
+        p[0] = static_cast<uint8_t>((window_size_increment >> 24) & 0x7F);
+        p[1] = static_cast<uint8_t>((window_size_increment >> 16) & 0xFF);
+        p[2] = static_cast<uint8_t>((window_size_increment >> 8) & 0xFF);
+        p[3] = static_cast<uint8_t>(window_size_increment & 0xFF);
+        push_iovec(p, 4);
+    }
+
+    // RST_STREAM frame (payload lives in the arena)
+    void add_rst_stream_frame(uint32_t stream_id, h2_error_code error_code) {
+        add_header(4, frame_type::rst_stream, 0, stream_id);
+        uint8_t* p = reinterpret_cast<uint8_t*>(arena_.allocate(4));
+        uint32_t code = static_cast<uint32_t>(error_code);
+        p[0] = static_cast<uint8_t>((code >> 24) & 0xFF);
+        p[1] = static_cast<uint8_t>((code >> 16) & 0xFF);
+        p[2] = static_cast<uint8_t>((code >> 8) & 0xFF);
+        p[3] = static_cast<uint8_t>(code & 0xFF);
+        push_iovec(p, 4);
+    }
+
+    // PING frame (payload copied into the arena, 8 bytes)
+    void add_ping_frame(std::span<const uint8_t, 8> data, bool ack) {
+        uint8_t flags = ack ? static_cast<uint8_t>(frame_flags::ack) : 0;
+        add_header(8, frame_type::ping, flags, 0);
+        char* p = arena_.allocate(8);
+        std::memcpy(p, data.data(), 8);
+        push_iovec(p, 8);
+    }
+
+    // Empty SETTINGS acknowledgment frame
+    void add_settings_ack() {
+        add_header(0, frame_type::settings, static_cast<uint8_t>(frame_flags::ack), 0);
+    }
+
+    // =============================================================================
+    // Scatter-Gather Export
+    // =============================================================================
+
+    // The recorded flight as one writev/sendmsg-ready list. Adjacent arena
+    // segments are coalesced, so back-to-back control frames cost one entry.
+    std::span<const struct iovec> iovecs() const noexcept {
+        return {iovecs_.data(), iovecs_.size()};
+    }
+
+    size_t frame_count() const noexcept { return frame_count_; }
+    size_t total_bytes() const noexcept { return total_bytes_; }
+    bool empty() const noexcept { return frame_count_ == 0; }
+
+    // Recycles arena blocks and the iovec list for the next flight
+    void clear() noexcept {
+        iovecs_.clear();
+        arena_.reset();
+        frame_count_ = 0;
+        total_bytes_ = 0;
+    }
+
+private:
+    void add_header(uint32_t length, frame_type type, uint8_t flags, uint32_t stream_id) {
+        frame_header header{};
+        header.length = length;
+        header.type = static_cast<uint8_t>(type);
+        header.flags = flags;
+        header.stream_id = stream_id;
+
+        char* p = arena_.allocate(frame_header::size);
+        header.serialize(reinterpret_cast<uint8_t*>(p));
+        push_iovec(p, frame_header::size);
+        ++frame_count_;
+    }
+
+    void add_external(std::span<const uint8_t> payload) {
+        if (!payload.empty()) {
+            push_iovec(payload.data(), payload.size());
+        }
+    }
+
+    void push_iovec(const void* base, size_t len) {
+        total_bytes_ += len;
+        if (!iovecs_.empty()) {
+            auto& last = iovecs_.back();
+            if (static_cast<const uint8_t*>(last.iov_base) + last.iov_len == base) {
+                last.iov_len += len;
+                return;
+            }
+        }
+        iovecs_.push_back({const_cast<void*>(base), len});
+    }
+
+    message_arena arena_;
+    std::vector<struct iovec> iovecs_;
+    size_t frame_count_ = 0;
+    size_t total_bytes_ = 0;
+};
+
+} // namespace co::http::v2
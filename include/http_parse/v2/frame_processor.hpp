@@ -13,8 +13,26 @@ namespace co::http::v2 {
 // HTTP/2 Frame Processor (High Performance)
 // =============================================================================
 
-class frame_processor {
-public:
+// Default-noop base for compile-time frame handlers: derive from it and
+// override only the events you care about. basic_frame_processor<Handler>
+// calls these methods directly, so overrides inline into the per-frame
+// dispatch with no indirect call.
+struct frame_handler {
+    void on_data(uint32_t /*stream_id*/, std::span<const uint8_t> /*data*/, bool /*end_stream*/) {}
+    void on_headers(uint32_t /*stream_id*/, const std::vector<::co::http::header>& /*headers*/, bool /*end_stream*/, bool /*end_headers*/) {}
+    void on_settings(const std::vector<setting>& /*settings*/) {}
+    void on_push_promise(uint32_t /*stream_id*/, uint32_t /*promised_stream_id*/, const std::vector<::co::http::header>& /*headers*/) {}
+    void on_ping(const std::array<uint8_t, 8>& /*data*/, bool /*ack*/) {}
+    void on_goaway(uint32_t /*last_stream_id*/, h2_error_code /*error_code*/, std::span<const uint8_t> /*debug_data*/) {}
+    void on_error(h2_error_code /*error_code*/, const std::string& /*description*/) {}
+};
+
+// Type-erased handler: the std::function-based convenience layer. Each
+// event checks and invokes the corresponding callback, so the classic
+// set_*_callback API costs one branch plus an indirect call per event -
+// fine for control frames, measurable on the per-DATA-frame path, which
+// is what basic_frame_processor with a concrete handler removes.
+struct function_handler {
     // Callback types for frame processing
     using headers_callback = std::function<void(uint32_t stream_id, const std::vector<::co::http::header>& headers, bool end_stream, bool end_headers)>;
     using data_callback = std::function<void(uint32_t stream_id, std::span<const uint8_t> data, bool end_stream)>;
@@ -30,32 +48,115 @@ public:
     using error_callback = std::function<void(h2_error_code error_code, const std::string& description)>;
     using unknown_frame_callback = std::function<void(const frame_header& header, std::span<const uint8_t> payload)>;
 
-    frame_processor(std::unique_ptr<stream_manager> stream_mgr = std::make_unique<stream_manager>());
-    ~frame_processor() = default;
+    headers_callback headers_callback_;
+    data_callback data_callback_;
+    priority_callback priority_callback_;
+    rst_stream_callback rst_stream_callback_;
+    settings_callback settings_callback_;
+    push_promise_callback push_promise_callback_;
+    ping_callback ping_callback_;
+    goaway_callback goaway_callback_;
+    window_update_callback window_update_callback_;
+    continuation_callback continuation_callback_;
+    connection_error_callback connection_error_callback_;
+    error_callback error_callback_;
+    unknown_frame_callback unknown_frame_callback_;
+
+    void on_data(uint32_t stream_id, std::span<const uint8_t> data, bool end_stream) {
+        if (data_callback_) {
+            data_callback_(stream_id, data, end_stream);
+        }
+    }
+    void on_headers(uint32_t stream_id, const std::vector<::co::http::header>& headers, bool end_stream, bool end_headers) {
+        if (headers_callback_) {
+            headers_callback_(stream_id, headers, end_stream, end_headers);
+        }
+    }
+    void on_settings(const std::vector<setting>& settings) {
+        if (settings_callback_) {
+            settings_callback_(settings);
+        }
+    }
+    void on_push_promise(uint32_t stream_id, uint32_t promised_stream_id, const std::vector<::co::http::header>& headers) {
+        if (push_promise_callback_) {
+            push_promise_callback_(stream_id, promised_stream_id, headers);
+        }
+    }
+    void on_ping(const std::array<uint8_t, 8>& data, bool ack) {
+        if (ping_callback_) {
+            ping_callback_(data, ack);
+        }
+    }
+    void on_goaway(uint32_t last_stream_id, h2_error_code error_code, std::span<const uint8_t> debug_data) {
+        if (goaway_callback_) {
+            goaway_callback_(last_stream_id, error_code, debug_data);
+        }
+    }
+    void on_error(h2_error_code error_code, const std::string& description) {
+        if (error_callback_) {
+            error_callback_(error_code, description);
+        }
+    }
+};
+
+// Frame processor with the handler bound at compile time: per-frame events
+// dispatch as direct (inlinable) calls on Handler, which provides the
+// on_data/on_headers/... methods of frame_handler. The default Handler is
+// function_handler, whose set_*_callback registration API makes the
+// `frame_processor` alias below behave exactly like the historical
+// type-erased class - pay for std::function only when you use it.
+template <typename Handler = function_handler>
+class basic_frame_processor {
+public:
+    using handler_type = Handler;
+
+    // Compatibility aliases for the type-erased callback signatures
+    using headers_callback = function_handler::headers_callback;
+    using data_callback = function_handler::data_callback;
+    using priority_callback = function_handler::priority_callback;
+    using rst_stream_callback = function_handler::rst_stream_callback;
+    using settings_callback = function_handler::settings_callback;
+    using push_promise_callback = function_handler::push_promise_callback;
+    using ping_callback = function_handler::ping_callback;
+    using goaway_callback = function_handler::goaway_callback;
+    using window_update_callback = function_handler::window_update_callback;
+    using continuation_callback = function_handler::continuation_callback;
+    using connection_error_callback = function_handler::connection_error_callback;
+    using error_callback = function_handler::error_callback;
+    using unknown_frame_callback = function_handler::unknown_frame_callback;
+
+    basic_frame_processor(std::unique_ptr<stream_manager> stream_mgr = std::make_unique<stream_manager>());
+    ~basic_frame_processor() = default;
 
     // Non-copyable, movable
-    frame_processor(const frame_processor&) = delete;
-    frame_processor& operator=(const frame_processor&) = delete;
-    frame_processor(frame_processor&&) = default;
-    frame_processor& operator=(frame_processor&&) = default;
+    basic_frame_processor(const basic_frame_processor&) = delete;
+    basic_frame_processor& operator=(const basic_frame_processor&) = delete;
+    basic_frame_processor(basic_frame_processor&&) = default;
+    basic_frame_processor& operator=(basic_frame_processor&&) = default;
+
+    // Direct access to the bound handler (state, custom configuration)
+    Handler& handler() noexcept { return handler_; }
+    const Handler& handler() const noexcept { return handler_; }
 
     // =============================================================================
-    // Callback Registration
+    // Callback Registration (function_handler only; these members are only
+    // instantiated when called, so concrete-handler instantiations that
+    // never use them compile fine)
     // =============================================================================
 
-    void set_headers_callback(headers_callback callback) { headers_callback_ = std::move(callback); }
-    void set_data_callback(data_callback callback) { data_callback_ = std::move(callback); }
-    void set_priority_callback(priority_callback callback) { priority_callback_ = std::move(callback); }
-    void set_rst_stream_callback(rst_stream_callback callback) { rst_stream_callback_ = std::move(callback); }
-    void set_settings_callback(settings_callback callback) { settings_callback_ = std::move(callback); }
-    void set_push_promise_callback(push_promise_callback callback) { push_promise_callback_ = std::move(callback); }
-    void set_ping_callback(ping_callback callback) { ping_callback_ = std::move(callback); }
-    void set_goaway_callback(goaway_callback callback) { goaway_callback_ = std::move(callback); }
-    void set_window_update_callback(window_update_callback callback) { window_update_callback_ = std::move(callback); }
-    void set_continuation_callback(continuation_callback callback) { continuation_callback_ = std::move(callback); }
-    void set_connection_error_callback(connection_error_callback callback) { connection_error_callback_ = std::move(callback); }
-    void set_error_callback(error_callback callback) { error_callback_ = std::move(callback); }
-    void set_unknown_frame_callback(unknown_frame_callback callback) { unknown_frame_callback_ = std::move(callback); }
+    void set_headers_callback(headers_callback callback) { handler_.headers_callback_ = std::move(callback); }
+    void set_data_callback(data_callback callback) { handler_.data_callback_ = std::move(callback); }
+    void set_priority_callback(priority_callback callback) { handler_.priority_callback_ = std::move(callback); }
+    void set_rst_stream_callback(rst_stream_callback callback) { handler_.rst_stream_callback_ = std::move(callback); }
+    void set_settings_callback(settings_callback callback) { handler_.settings_callback_ = std::move(callback); }
+    void set_push_promise_callback(push_promise_callback callback) { handler_.push_promise_callback_ = std::move(callback); }
+    void set_ping_callback(ping_callback callback) { handler_.ping_callback_ = std::move(callback); }
+    void set_goaway_callback(goaway_callback callback) { handler_.goaway_callback_ = std::move(callback); }
+    void set_window_update_callback(window_update_callback callback) { handler_.window_update_callback_ = std::move(callback); }
+    void set_continuation_callback(continuation_callback callback) { handler_.continuation_callback_ = std::move(callback); }
+    void set_connection_error_callback(connection_error_callback callback) { handler_.connection_error_callback_ = std::move(callback); }
+    void set_error_callback(error_callback callback) { handler_.error_callback_ = std::move(callback); }
+    void set_unknown_frame_callback(unknown_frame_callback callback) { handler_.unknown_frame_callback_ = std::move(callback); }
 
     // =============================================================================
     // Frame Processing
@@ -63,6 +164,13 @@ public:
 
     // Process incoming frame data
     std::expected<size_t, h2_error_code> process_frames(std::span<const uint8_t> data);
+
+    // Vectored variant for readv-style ingestion. The incremental state
+    // machine walks each buffer directly; a 9-byte frame header straddling a
+    // boundary is gathered into a stack scratch, and only a payload that
+    // itself spans buffers goes through frame_buffer_ - the staging copy of
+    // the whole read disappears.
+    std::expected<size_t, h2_error_code> process_frames(std::span<const std::span<const uint8_t>> buffers);
     
     // Process single frame or partial frame data
     std::expected<size_t, h2_error_code> process_frame(std::span<const uint8_t> data) { return process_frames(data); }
@@ -70,6 +178,29 @@ public:
     // Process connection preface
     std::expected<size_t, h2_error_code> process_connection_preface(std::span<const uint8_t> data);
 
+    // =============================================================================
+    // Batch Processing
+    // =============================================================================
+
+    // One connection's slot in a process_batch call. `result` mirrors what
+    // process_frames would have returned for this input: bytes consumed on
+    // success, or the connection's error. needs_more_data is set when the
+    // input ends inside a frame.
+    struct batch_item {
+        basic_frame_processor* processor = nullptr;
+        std::span<const uint8_t> input{};
+
+        std::expected<size_t, h2_error_code> result{0};
+        bool needs_more_data = false;
+    };
+
+    // Processes many connections' inputs in a software-pipelined order:
+    // each round decodes the 9-byte frame headers across all connections
+    // before any payload is dispatched, so the decode stage runs the same
+    // hot code back to back instead of re-fetching every processor's HPACK
+    // tables and stream maps cold between events.
+    static void process_batch(std::span<batch_item> items);
+
     // =============================================================================
     // Frame Generation
     // =============================================================================
@@ -90,7 +221,14 @@ public:
     std::expected<size_t, h2_error_code> generate_rst_stream_frame(uint32_t stream_id, h2_error_code error_code, 
                                                                  output_buffer& output);
 
-    // Generate SETTINGS frame
+    // Generate SETTINGS frame. HTTP/2 defines six setting ids, so callers on
+    // the connection-setup path pass a fixed {id, value} array (see
+    // connection_settings::serialize_nondefault) - no hash-map allocation to
+    // send ~36 bytes.
+    std::expected<size_t, h2_error_code> generate_settings_frame(std::span<const setting> settings,
+                                                               bool ack, output_buffer& output);
+
+    // Convenience overload for callers that already hold a map
     std::expected<size_t, h2_error_code> generate_settings_frame(const std::unordered_map<uint16_t, uint32_t>& settings,
                                                                bool ack, output_buffer& output);
 
@@ -117,6 +255,28 @@ public:
     // Generate connection preface
     std::expected<size_t, h2_error_code> generate_connection_preface(output_buffer& output);
 
+    // The full client preamble per RFC 7540 section 3.5: the 24-byte magic
+    // followed by the initial SETTINGS frame. With default settings the
+    // SETTINGS payload is empty, so the whole preamble is a fixed blob built
+    // once and shared by every connection - opening a connection copies 33
+    // bytes instead of formatting frames.
+    static std::span<const uint8_t> client_preamble() noexcept;
+
+    // =============================================================================
+    // Flow Control
+    // =============================================================================
+
+    // Records that the application consumed `bytes` of received DATA on the
+    // stream. WINDOW_UPDATE generation is coalesced: nothing is emitted
+    // until the unacknowledged total (per stream and per connection)
+    // crosses the threshold, then a single frame credits the whole amount.
+    // Returns the number of bytes appended to `output`.
+    std::expected<size_t, h2_error_code> consume_data(uint32_t stream_id, size_t bytes, output_buffer& output);
+
+    // Overrides the coalescing threshold in bytes; 0 restores the default
+    // of half the initial window size
+    void set_window_update_threshold(uint32_t bytes) { window_update_threshold_ = bytes; }
+
     // =============================================================================
     // Configuration and State
     // =============================================================================
@@ -136,6 +296,49 @@ public:
     // Reset processor state
     void reset();
 
+    // =============================================================================
+    // Memory Budgeting
+    // =============================================================================
+
+    // Caps what this connection may retain in its staging buffers: split
+    // frames accumulating in frame_buffer_ and header blocks spanning
+    // CONTINUATIONs in header_block_buffer_. Without a cap a peer
+    // advertising 16MB frames can pin 16MB per connection, which is what
+    // bounds connection density - the budget makes the worst case explicit.
+    struct memory_budget {
+        // Behavior when buffering a frame would exceed the cap
+        enum class overflow_policy : uint8_t {
+            // Fail the connection with ENHANCE_YOUR_CALM
+            connection_error,
+            // Stop consuming input and latch backpressured(); the caller
+            // stops reading the socket until it raises the budget or
+            // resets the connection
+            backpressure,
+        };
+
+        size_t max_buffered_bytes = 1024 * 1024;
+        // Buffer capacity above this is released once the buffer empties,
+        // so one large frame does not pin its high-water mark forever
+        size_t shrink_threshold = 64 * 1024;
+        overflow_policy policy = overflow_policy::connection_error;
+    };
+
+    // Raising the budget clears a latched backpressure stall
+    void set_memory_budget(const memory_budget& budget) noexcept {
+        budget_ = budget;
+        backpressured_ = false;
+    }
+    const memory_budget& get_memory_budget() const noexcept { return budget_; }
+
+    // Bytes currently retained across the staging buffers
+    size_t buffered_bytes() const noexcept {
+        return frame_buffer_.size() + header_block_buffer_.size();
+    }
+
+    // True when overflow_policy::backpressure stopped intake; cleared by
+    // set_memory_budget or reset
+    bool backpressured() const noexcept { return backpressured_; }
+
     // Get processing statistics
     struct stats {
         uint64_t frames_processed = 0;
@@ -144,6 +347,11 @@ public:
         uint64_t headers_frames = 0;
         uint64_t control_frames = 0;
         uint64_t errors = 0;
+        // Memory budgeting: rejected buffer growth events, capacity
+        // releases after large frames, and the most bytes ever retained
+        uint64_t budget_overflows = 0;
+        uint64_t buffer_shrinks = 0;
+        uint64_t peak_buffered_bytes = 0;
     };
     
     const stats& get_stats() const noexcept { return stats_; }
@@ -171,25 +379,21 @@ private:
     bool connection_preface_received_ = false;
     size_t preface_bytes_received_ = 0;
 
+    // Flow control accounting
+    uint64_t connection_unacked_ = 0;
+    uint32_t window_update_threshold_ = 0;
+
+    // Memory budgeting
+    memory_budget budget_;
+    bool backpressured_ = false;
+
     // Components
     std::unique_ptr<stream_manager> stream_manager_;
     ::co::http::detail::hpack_encoder hpack_encoder_;
     ::co::http::detail::hpack_decoder hpack_decoder_;
 
-    // Callbacks
-    headers_callback headers_callback_;
-    data_callback data_callback_;
-    priority_callback priority_callback_;
-    rst_stream_callback rst_stream_callback_;
-    settings_callback settings_callback_;
-    push_promise_callback push_promise_callback_;
-    ping_callback ping_callback_;
-    goaway_callback goaway_callback_;
-    window_update_callback window_update_callback_;
-    continuation_callback continuation_callback_;
-    connection_error_callback connection_error_callback_;
-    error_callback error_callback_;
-    unknown_frame_callback unknown_frame_callback_;
+    // Event handler (bound at compile time)
+    Handler handler_;
 
     // Statistics
     stats stats_;
@@ -220,6 +424,11 @@ private:
 
     // Utility methods
     void emit_connection_error(h2_error_code error_code, std::string_view debug_info = "");
+
+    // Memory budgeting helpers: admit `additional` staging bytes or reject
+    // per the overflow policy; release capacity grown past the threshold
+    std::expected<void, h2_error_code> charge_budget(size_t additional);
+    void maybe_shrink(std::vector<uint8_t>& buffer);
     std::expected<void, h2_error_code> handle_headers_complete(uint32_t stream_id, bool end_stream);
 
     // Frame generation helpers
@@ -227,6 +436,10 @@ private:
     size_t write_settings_payload(const std::unordered_map<uint16_t, uint32_t>& settings, output_buffer& output);
 };
 
+// The historical type-erased processor: set_*_callback registration with
+// std::function dispatch
+using frame_processor = basic_frame_processor<function_handler>;
+
 } // namespace co::http::v2
 
 // Include implementation
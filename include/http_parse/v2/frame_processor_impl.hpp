@@ -10,14 +10,16 @@ namespace co::http::v2 {
 // Frame Processor Implementation
 // =============================================================================
 
-inline frame_processor::frame_processor(std::unique_ptr<stream_manager> stream_mgr) 
+template <typename Handler>
+inline basic_frame_processor<Handler>::basic_frame_processor(std::unique_ptr<stream_manager> stream_mgr) 
     : stream_manager_(std::move(stream_mgr)) {
     if (!stream_manager_) {
         stream_manager_ = std::make_unique<stream_manager>();
     }
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::process_frames(std::span<const uint8_t> data) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_frames(std::span<const uint8_t> data) {
     size_t total_processed = 0;
     
     while (total_processed < data.size()) {
@@ -40,7 +42,130 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_frames(std:
     return total_processed;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::process_connection_preface(std::span<const uint8_t> data) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_frames(std::span<const std::span<const uint8_t>> buffers) {
+    size_t total_processed = 0;
+    size_t i = 0;
+    size_t offset = 0;
+
+    while (i < buffers.size()) {
+        std::span<const uint8_t> current = buffers[i].subspan(offset);
+        if (current.empty()) {
+            ++i;
+            offset = 0;
+            continue;
+        }
+
+        auto result = process_single_frame(current);
+        if (!result) {
+            return result;
+        }
+        if (*result > 0) {
+            total_processed += *result;
+            stats_.bytes_processed += *result;
+            offset += *result;
+            continue;
+        }
+
+        // A zero-byte step means a 9-byte frame header straddles this
+        // buffer's end: gather it from the following buffers into a stack
+        // scratch and decode from there
+        std::array<uint8_t, frame_header::size> scratch;
+        size_t have = current.size();
+        std::memcpy(scratch.data(), current.data(), have);
+        for (size_t j = i + 1; have < frame_header::size && j < buffers.size(); ++j) {
+            size_t take = std::min(frame_header::size - have, buffers[j].size());
+            std::memcpy(scratch.data() + have, buffers[j].data(), take);
+            have += take;
+        }
+        if (have < frame_header::size) {
+            break; // Genuinely out of input; the header tail stays unconsumed
+        }
+
+        auto header_result = process_single_frame(std::span<const uint8_t>(scratch.data(), frame_header::size));
+        if (!header_result) {
+            return header_result;
+        }
+        total_processed += frame_header::size;
+        stats_.bytes_processed += frame_header::size;
+
+        // Advance past the gathered bytes: the rest of the current buffer
+        // plus the overflow taken from the following ones
+        size_t remaining_skip = frame_header::size - current.size();
+        ++i;
+        offset = 0;
+        while (remaining_skip > 0) {
+            size_t take = std::min(remaining_skip, buffers[i].size() - offset);
+            offset += take;
+            remaining_skip -= take;
+            if (remaining_skip > 0) {
+                ++i;
+                offset = 0;
+            }
+        }
+    }
+
+    return total_processed;
+}
+
+template <typename Handler>
+inline void basic_frame_processor<Handler>::process_batch(std::span<batch_item> items) {
+    // Advances one item by a single state-machine step; returns false once
+    // the item is blocked (error, need-more-data or input exhausted)
+    auto step = [](batch_item& item) -> bool {
+        auto& processor = *item.processor;
+        auto result = processor.process_single_frame(item.input.subspan(*item.result));
+        if (!result) {
+            item.result = std::unexpected{result.error()};
+            return false;
+        }
+        if (*result == 0) {
+            item.needs_more_data = true;
+            return false;
+        }
+        *item.result += *result;
+        processor.stats_.bytes_processed += *result;
+        return true;
+    };
+
+    auto active = [](const batch_item& item) {
+        return item.processor != nullptr && item.result.has_value() &&
+               !item.needs_more_data && *item.result < item.input.size();
+    };
+
+    bool progress = true;
+    while (progress) {
+        progress = false;
+
+        // Stage 1: frame-header decode across all connections
+        for (auto& item : items) {
+            if (active(item) &&
+                item.processor->state_ != processing_state::expecting_payload) {
+                progress |= step(item);
+            }
+        }
+
+        // Stage 2: payload dispatch across all connections
+        for (auto& item : items) {
+            if (active(item) &&
+                item.processor->state_ == processing_state::expecting_payload) {
+                progress |= step(item);
+            }
+        }
+    }
+
+    // An input that ran out exactly mid-frame consumed every byte without a
+    // short step; the processor state still says the frame is unfinished
+    for (auto& item : items) {
+        if (item.processor != nullptr && item.result.has_value() &&
+            item.processor->state_ != processing_state::expecting_header) {
+            item.needs_more_data = true;
+        }
+    }
+}
+
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_connection_preface(std::span<const uint8_t> data) {
     if (connection_preface_received_) {
         return 0;
     }
@@ -62,7 +187,8 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_connection_
     return available;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::process_single_frame(std::span<const uint8_t> data) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_single_frame(std::span<const uint8_t> data) {
     switch (state_) {
         case processing_state::expecting_header:
             return process_frame_header(data);
@@ -85,7 +211,16 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_single_fram
             if (current_header_.stream_id != continuation_stream_id_) {
                 return std::unexpected{h2_error_code::protocol_error};
             }
-            
+
+            // The fragment joins header_block_buffer_, so admit it against
+            // the budget before consuming the frame header
+            if (auto budget = charge_budget(current_header_.length); !budget) {
+                if (backpressured_) {
+                    return 0; // Stall: the header was not consumed
+                }
+                return std::unexpected{budget.error()};
+            }
+
             state_ = processing_state::expecting_payload;
             bytes_needed_ = current_header_.length;
             return frame_header::size;
@@ -95,18 +230,32 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_single_fram
     }
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::process_frame_header(std::span<const uint8_t> data) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_frame_header(std::span<const uint8_t> data) {
     if (data.size() < frame_header::size) {
         return 0; // Need more data
     }
-    
+
     current_header_ = frame_header::parse(data.data());
-    
+
     // Validate frame header
     if (auto result = validate_frame_header(current_header_); !result) {
         return std::unexpected{result.error()};
     }
-    
+
+    // A HEADERS frame without END_HEADERS is retained in
+    // header_block_buffer_ until the block completes - charge it here, at
+    // the frame boundary, where intake can still stop cleanly
+    if (current_header_.type == static_cast<uint8_t>(frame_type::headers) &&
+        !(current_header_.flags & static_cast<uint8_t>(frame_flags::end_headers))) {
+        if (auto budget = charge_budget(current_header_.length); !budget) {
+            if (backpressured_) {
+                return 0; // Stall: the header was not consumed
+            }
+            return std::unexpected{budget.error()};
+        }
+    }
+
     state_ = processing_state::expecting_payload;
     bytes_needed_ = current_header_.length;
     frame_buffer_.clear();
@@ -116,13 +265,35 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_frame_heade
     return frame_header::size;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::process_frame_payload(std::span<const uint8_t> data) {
-    if (data.size() < bytes_needed_) {
-        return 0; // Need more data
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::process_frame_payload(std::span<const uint8_t> data) {
+    std::span<const uint8_t> payload;
+    size_t consumed = 0;
+
+    if (frame_buffer_.empty() && data.size() >= bytes_needed_) {
+        // Fast path: the whole payload is contiguous in the caller's input,
+        // so dispatch it in place. DATA payloads reach the handler without
+        // ever being copied.
+        payload = data.subspan(0, bytes_needed_);
+        consumed = bytes_needed_;
+    } else {
+        // Slow path: the frame is split across reads, accumulate it
+        size_t take = std::min(data.size(), bytes_needed_);
+        if (auto budget = charge_budget(take); !budget) {
+            if (backpressured_) {
+                return 0; // Stall: nothing consumed from this read
+            }
+            return std::unexpected{budget.error()};
+        }
+        frame_buffer_.insert(frame_buffer_.end(), data.begin(), data.begin() + take);
+        bytes_needed_ -= take;
+        if (bytes_needed_ > 0) {
+            return take; // Rest of the payload arrives in a later read
+        }
+        payload = std::span<const uint8_t>(frame_buffer_.data(), frame_buffer_.size());
+        consumed = take;
     }
-    
-    auto payload = data.subspan(0, bytes_needed_);
-    
+
     // Process frame based on type
     std::expected<void, h2_error_code> result;
     
@@ -187,17 +358,21 @@ inline std::expected<size_t, h2_error_code> frame_processor::process_frame_paylo
         stats_.errors++;
         return std::unexpected{result.error()};
     }
-    
-    // Reset state for next frame
+
+    // Reset state for next frame; capacity grown by one large split frame
+    // is released instead of staying pinned for the connection's lifetime
+    frame_buffer_.clear();
+    maybe_shrink(frame_buffer_);
     if (!expecting_continuation_) {
         state_ = processing_state::expecting_header;
         bytes_needed_ = frame_header::size;
     }
-    
-    return bytes_needed_;
+
+    return consumed;
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_data_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_data_frame(const frame_header& header, std::span<const uint8_t> payload) {
     // Validate stream ID
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
@@ -239,15 +414,14 @@ inline std::expected<void, h2_error_code> frame_processor::process_data_frame(co
         stream_manager_->half_close_stream_remote(header.stream_id);
     }
     
-    // Call callback
-    if (data_callback_) {
-        data_callback_(header.stream_id, data_payload, end_stream);
-    }
+    // Dispatch to handler
+    handler_.on_data(header.stream_id, data_payload, end_stream);
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_headers_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_headers_frame(const frame_header& header, std::span<const uint8_t> payload) {
     // Validate stream ID
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
@@ -318,17 +492,13 @@ inline std::expected<void, h2_error_code> frame_processor::process_headers_frame
         return {};
     }
     
-    // Complete header block
-    std::span<const uint8_t> complete_header_block;
-    if (header_block_buffer_.empty()) {
-        complete_header_block = headers_payload;
-    } else {
-        header_block_buffer_.insert(header_block_buffer_.end(), headers_payload.begin(), headers_payload.end());
-        complete_header_block = std::span<const uint8_t>(header_block_buffer_);
-    }
-    
-    // Decode headers using HPACK
-    auto decoded_headers = hpack_decoder_.decode_headers(complete_header_block);
+    // END_HEADERS on the first frame - the overwhelmingly common case - means
+    // the payload span already is the complete header block, so HPACK decodes
+    // straight from the caller's input without touching header_block_buffer_.
+    // (The state machine only routes a HEADERS frame here when no
+    // continuation is pending, so the buffer is necessarily empty; fragmented
+    // blocks are reassembled in process_continuation_frame instead.)
+    auto decoded_headers = hpack_decoder_.decode_headers(headers_payload);
     if (!decoded_headers) {
         return std::unexpected{h2_error_code::compression_error};
     }
@@ -339,19 +509,14 @@ inline std::expected<void, h2_error_code> frame_processor::process_headers_frame
         stream_manager_->half_close_stream_remote(header.stream_id);
     }
     
-    // Call callback
-    if (headers_callback_) {
-        headers_callback_(header.stream_id, *decoded_headers, end_stream, true);
-    }
-    
-    // Clean up
-    header_block_buffer_.clear();
-    expecting_continuation_ = false;
-    
+    // Dispatch to handler
+    handler_.on_headers(header.stream_id, *decoded_headers, end_stream, true);
+
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_settings_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_settings_frame(const frame_header& header, std::span<const uint8_t> payload) {
     // Settings frames must have stream ID 0
     if (header.stream_id != 0) {
         return std::unexpected{h2_error_code::protocol_error};
@@ -365,11 +530,9 @@ inline std::expected<void, h2_error_code> frame_processor::process_settings_fram
             return std::unexpected{h2_error_code::frame_size_error};
         }
         
-        // Call callback
-        if (settings_callback_) {
-            std::vector<setting> empty_settings;
-            settings_callback_(empty_settings);
-        }
+        // Dispatch to handler
+        std::vector<setting> empty_settings;
+        handler_.on_settings(empty_settings);
         
         return {};
     }
@@ -403,19 +566,18 @@ inline std::expected<void, h2_error_code> frame_processor::process_settings_fram
     
     stream_manager_->update_settings(new_settings);
     
-    // Call callback
-    if (settings_callback_) {
-        std::vector<setting> setting_list;
-        for (const auto& [id, value] : settings) {
-            setting_list.push_back({id, value});
-        }
-        settings_callback_(setting_list);
+    // Dispatch to handler
+    std::vector<setting> setting_list;
+    for (const auto& [id, value] : settings) {
+        setting_list.push_back({id, value});
     }
+    handler_.on_settings(setting_list);
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::validate_frame_header(const frame_header& header) const {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::validate_frame_header(const frame_header& header) const {
     // Check frame size limits
     if (header.length > stream_manager_->get_settings().max_frame_size) {
         return std::unexpected{h2_error_code::frame_size_error};
@@ -461,7 +623,8 @@ inline std::expected<void, h2_error_code> frame_processor::validate_frame_header
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::validate_stream_state(uint32_t stream_id, frame_type type) const {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::validate_stream_state(uint32_t stream_id, frame_type type) const {
     auto* stream = stream_manager_->get_stream(stream_id);
     
     if (!stream) {
@@ -493,32 +656,104 @@ inline std::expected<void, h2_error_code> frame_processor::validate_stream_state
     return {};
 }
 
-inline void frame_processor::reset() {
+template <typename Handler>
+inline void basic_frame_processor<Handler>::reset() {
     state_ = processing_state::expecting_header;
     bytes_needed_ = frame_header::size;
     frame_buffer_.clear();
+    maybe_shrink(frame_buffer_);
     header_block_buffer_.clear();
+    maybe_shrink(header_block_buffer_);
+    backpressured_ = false;
     expecting_continuation_ = false;
     continuation_stream_id_ = 0;
     connection_preface_received_ = false;
     preface_bytes_received_ = 0;
+    connection_unacked_ = 0;
     
     if (stream_manager_) {
         stream_manager_->reset();
     }
 }
 
-inline void frame_processor::update_settings(const connection_settings& settings) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::charge_budget(size_t additional) {
+    size_t total = buffered_bytes() + additional;
+    if (total > budget_.max_buffered_bytes) {
+        stats_.budget_overflows++;
+        if (budget_.policy == memory_budget::overflow_policy::backpressure) {
+            backpressured_ = true;
+        }
+        return std::unexpected{h2_error_code::enhance_your_calm};
+    }
+    if (total > stats_.peak_buffered_bytes) {
+        stats_.peak_buffered_bytes = total;
+    }
+    return {};
+}
+
+template <typename Handler>
+inline void basic_frame_processor<Handler>::maybe_shrink(std::vector<uint8_t>& buffer) {
+    if (buffer.capacity() > budget_.shrink_threshold) {
+        buffer.shrink_to_fit();
+        stats_.buffer_shrinks++;
+    }
+}
+
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::consume_data(uint32_t stream_id, size_t bytes, output_buffer& output) {
+    auto* stream = stream_manager_->get_stream(stream_id);
+    if (!stream) {
+        return std::unexpected{h2_error_code::protocol_error};
+    }
+
+    stream->unacked_consumed += static_cast<uint32_t>(bytes);
+    connection_unacked_ += bytes;
+
+    uint32_t threshold = window_update_threshold_ != 0
+        ? window_update_threshold_
+        : stream_manager_->get_settings().initial_window_size / 2;
+
+    size_t bytes_written = 0;
+
+    if (stream->unacked_consumed >= threshold && stream->can_receive_data()) {
+        uint32_t increment = stream->unacked_consumed;
+        auto result = generate_window_update_frame(stream_id, increment, output);
+        if (!result) {
+            return std::unexpected{result.error()};
+        }
+        bytes_written += *result;
+        // Credit back the receive window that process_data_frame debited
+        (void)stream_manager_->update_stream_window(stream_id, static_cast<int32_t>(increment));
+        stream->unacked_consumed = 0;
+    }
+
+    if (connection_unacked_ >= threshold) {
+        auto result = generate_window_update_frame(0, static_cast<uint32_t>(connection_unacked_), output);
+        if (!result) {
+            return std::unexpected{result.error()};
+        }
+        bytes_written += *result;
+        connection_unacked_ = 0;
+    }
+
+    return bytes_written;
+}
+
+template <typename Handler>
+inline void basic_frame_processor<Handler>::update_settings(const connection_settings& settings) {
     if (stream_manager_) {
         stream_manager_->update_settings(settings);
     }
 }
 
-inline const connection_settings& frame_processor::get_settings() const noexcept {
+template <typename Handler>
+inline const connection_settings& basic_frame_processor<Handler>::get_settings() const noexcept {
     return stream_manager_->get_settings();
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_priority_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_priority_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -541,7 +776,8 @@ inline std::expected<void, h2_error_code> frame_processor::process_priority_fram
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_rst_stream_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_rst_stream_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -557,14 +793,13 @@ inline std::expected<void, h2_error_code> frame_processor::process_rst_stream_fr
     
     stream_manager_->close_stream(header.stream_id, static_cast<h2_error_code>(error_code));
     
-    if (error_callback_) {
-        error_callback_(static_cast<h2_error_code>(error_code), "RST_STREAM frame received");
-    }
+    handler_.on_error(static_cast<h2_error_code>(error_code), "RST_STREAM frame received");
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_push_promise_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_push_promise_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -588,14 +823,13 @@ inline std::expected<void, h2_error_code> frame_processor::process_push_promise_
         return std::unexpected{h2_error_code::compression_error};
     }
     
-    if (push_promise_callback_) {
-        push_promise_callback_(header.stream_id, promised_stream_id, *decoded_headers);
-    }
+    handler_.on_push_promise(header.stream_id, promised_stream_id, *decoded_headers);
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_ping_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_ping_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id != 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -606,16 +840,15 @@ inline std::expected<void, h2_error_code> frame_processor::process_ping_frame(co
     
     bool ack = header.flags & static_cast<uint8_t>(frame_flags::ack);
     
-    if (ping_callback_) {
-        std::array<uint8_t, 8> ping_data{};
-        std::copy_n(payload.data(), std::min(payload.size(), size_t(8)), ping_data.data());
-        ping_callback_(ping_data, ack);
-    }
+    std::array<uint8_t, 8> ping_data{};
+    std::copy_n(payload.data(), std::min(payload.size(), size_t(8)), ping_data.data());
+    handler_.on_ping(ping_data, ack);
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_goaway_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_goaway_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id != 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -638,14 +871,13 @@ inline std::expected<void, h2_error_code> frame_processor::process_goaway_frame(
     
     auto debug_data = payload.subspan(8);
     
-    if (goaway_callback_) {
-        goaway_callback_(last_stream_id, static_cast<h2_error_code>(error_code), debug_data);
-    }
+    handler_.on_goaway(last_stream_id, static_cast<h2_error_code>(error_code), debug_data);
     
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_window_update_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_window_update_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (payload.size() != 4) {
         return std::unexpected{h2_error_code::frame_size_error};
     }
@@ -669,7 +901,8 @@ inline std::expected<void, h2_error_code> frame_processor::process_window_update
     return {};
 }
 
-inline std::expected<void, h2_error_code> frame_processor::process_continuation_frame(const frame_header& header, std::span<const uint8_t> payload) {
+template <typename Handler>
+inline std::expected<void, h2_error_code> basic_frame_processor<Handler>::process_continuation_frame(const frame_header& header, std::span<const uint8_t> payload) {
     if (header.stream_id == 0) {
         return std::unexpected{h2_error_code::protocol_error};
     }
@@ -688,11 +921,10 @@ inline std::expected<void, h2_error_code> frame_processor::process_continuation_
             return std::unexpected{h2_error_code::compression_error};
         }
         
-        if (headers_callback_) {
-            headers_callback_(header.stream_id, *decoded_headers, false, false);
-        }
+        handler_.on_headers(header.stream_id, *decoded_headers, false, false);
         
         header_block_buffer_.clear();
+        maybe_shrink(header_block_buffer_);
         expecting_continuation_ = false;
         continuation_stream_id_ = 0;
         state_ = processing_state::expecting_header;
@@ -701,12 +933,14 @@ inline std::expected<void, h2_error_code> frame_processor::process_continuation_
     return {};
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_connection_preface(output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_connection_preface(output_buffer& buffer) {
     buffer.append(connection_preface);
     return connection_preface.size();
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_headers_frame(uint32_t stream_id, const std::vector<header>& headers, bool end_stream, bool end_headers, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_headers_frame(uint32_t stream_id, const std::vector<header>& headers, bool end_stream, bool end_headers, output_buffer& buffer) {
     output_buffer temp_buffer;
     auto result = hpack_encoder_.encode_headers(headers, temp_buffer);
     if (!result) {
@@ -727,7 +961,8 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_headers_fr
     return frame_header::size + encoded_headers.size();
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_data_frame(uint32_t stream_id, std::span<const uint8_t> data, bool end_stream, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_data_frame(uint32_t stream_id, std::span<const uint8_t> data, bool end_stream, output_buffer& buffer) {
     frame_header header;
     header.length = data.size();
     header.type = static_cast<uint8_t>(frame_type::data);
@@ -741,15 +976,16 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_data_frame
 }
 
 // Additional missing method implementations
-inline std::expected<size_t, h2_error_code> frame_processor::generate_settings_frame(const std::unordered_map<uint16_t, uint32_t>& settings, bool ack, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_settings_frame(std::span<const setting> settings, bool ack, output_buffer& buffer) {
     frame_header header;
     header.length = ack ? 0 : settings.size() * 6;
     header.type = static_cast<uint8_t>(frame_type::settings);
     header.flags = ack ? static_cast<uint8_t>(frame_flags::ack) : 0;
     header.stream_id = 0;
-    
+
     buffer.append(header.serialize());
-    
+
     if (!ack) {
         for (const auto& [id, value] : settings) {
             uint8_t setting_data[6];
@@ -762,11 +998,50 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_settings_f
             buffer.append(std::span<const uint8_t>(setting_data, 6));
         }
     }
-    
+
     return frame_header::size + header.length;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_ping_frame(std::span<const uint8_t, 8> data, bool ack, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_settings_frame(const std::unordered_map<uint16_t, uint32_t>& settings, bool ack, output_buffer& buffer) {
+    // Known ids fit the fixed array; a map with exotic extension ids falls
+    // back to a heap copy, which is not a setup-path concern
+    std::array<setting, connection_settings::max_settings> fixed;
+    if (settings.size() <= fixed.size()) {
+        size_t count = 0;
+        for (const auto& [id, value] : settings) {
+            fixed[count++] = {id, value};
+        }
+        return generate_settings_frame(std::span<const setting>(fixed.data(), count), ack, buffer);
+    }
+    std::vector<setting> spilled;
+    spilled.reserve(settings.size());
+    for (const auto& [id, value] : settings) {
+        spilled.push_back({id, value});
+    }
+    return generate_settings_frame(std::span<const setting>(spilled), ack, buffer);
+}
+
+template <typename Handler>
+inline std::span<const uint8_t> basic_frame_processor<Handler>::client_preamble() noexcept {
+    // Preface magic plus an initial SETTINGS frame whose payload is empty
+    // (defaults need not be transmitted), assembled once per process
+    static const auto blob = [] {
+        std::array<uint8_t, connection_preface.size() + frame_header::size> bytes{};
+        std::memcpy(bytes.data(), connection_preface.data(), connection_preface.size());
+        frame_header settings_header;
+        settings_header.length = 0;
+        settings_header.type = static_cast<uint8_t>(frame_type::settings);
+        settings_header.flags = 0;
+        settings_header.stream_id = 0;
+        settings_header.serialize(bytes.data() + connection_preface.size());
+        return bytes;
+    }();
+    return blob;
+}
+
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_ping_frame(std::span<const uint8_t, 8> data, bool ack, output_buffer& buffer) {
     frame_header header;
     header.length = 8;
     header.type = static_cast<uint8_t>(frame_type::ping);
@@ -779,7 +1054,8 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_ping_frame
     return frame_header::size + 8;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_goaway_frame(uint32_t last_stream_id, h2_error_code error_code, std::string_view debug_data, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_goaway_frame(uint32_t last_stream_id, h2_error_code error_code, std::string_view debug_data, output_buffer& buffer) {
     frame_header header;
     header.length = 8 + debug_data.size();
     header.type = static_cast<uint8_t>(frame_type::goaway);
@@ -808,7 +1084,8 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_goaway_fra
     return frame_header::size + header.length;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_window_update_frame(uint32_t stream_id, uint32_t window_size_increment, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_window_update_frame(uint32_t stream_id, uint32_t window_size_increment, output_buffer& buffer) {
     frame_header header;
     header.length = 4;
     header.type = static_cast<uint8_t>(frame_type::window_update);
@@ -828,7 +1105,8 @@ inline std::expected<size_t, h2_error_code> frame_processor::generate_window_upd
     return frame_header::size + 4;
 }
 
-inline std::expected<size_t, h2_error_code> frame_processor::generate_rst_stream_frame(uint32_t stream_id, h2_error_code error_code, output_buffer& buffer) {
+template <typename Handler>
+inline std::expected<size_t, h2_error_code> basic_frame_processor<Handler>::generate_rst_stream_frame(uint32_t stream_id, h2_error_code error_code, output_buffer& buffer) {
     frame_header header;
     header.length = 4;
     header.type = static_cast<uint8_t>(frame_type::rst_stream);
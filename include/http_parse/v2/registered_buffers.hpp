@@ -0,0 +1,201 @@
+#pragma once
+
+#include "frame_processor.hpp"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace co::http::v2 {
+
+// =============================================================================
+// Registered-Buffer Zero-Copy Ingestion
+// =============================================================================
+
+// Adapter for io_uring-style fixed buffers. The caller registers long-lived
+// buffers once; ingest() then feeds (buffer-id, offset, length) slices.
+// Whole frames dispatch straight out of the registered memory - the
+// processor's in-place fast path applies, so DATA payloads travel from NIC
+// memory to the application callback without a copy. A frame that ends
+// inside a slice is pinned as slice records rather than copied into
+// frame_buffer_; only a frame spanning non-contiguous slices is assembled
+// (into an internal scratch, the cost the copying fallback would pay anyway).
+//
+// Buffer-lifetime contract: registered memory must stay valid and unmodified
+// while any of it is pinned. releasable_up_to(id) reports the lowest offset
+// still pinned, so the caller knows exactly how much space can be recycled
+// back to the ring.
+class registered_buffer_ingest {
+public:
+    explicit registered_buffer_ingest(frame_processor& processor) : processor_(&processor) {}
+
+    // Non-copyable, movable (mirrors frame_processor)
+    registered_buffer_ingest(const registered_buffer_ingest&) = delete;
+    registered_buffer_ingest& operator=(const registered_buffer_ingest&) = delete;
+    registered_buffer_ingest(registered_buffer_ingest&&) = default;
+    registered_buffer_ingest& operator=(registered_buffer_ingest&&) = default;
+
+    void register_buffer(uint16_t id, std::span<const uint8_t> memory) {
+        buffers_[id] = memory;
+    }
+
+    // The buffer must not be unregistered while slices of it are pinned
+    void unregister_buffer(uint16_t id) { buffers_.erase(id); }
+
+    // Feeds [offset, offset + length) of registered buffer `id`. Returns the
+    // number of bytes handed to the processor during this call; bytes of an
+    // unfinished trailing frame stay pinned and are counted by the call that
+    // completes the frame.
+    std::expected<size_t, h2_error_code> ingest(uint16_t id, size_t offset, size_t length) {
+        auto it = buffers_.find(id);
+        if (it == buffers_.end() || offset + length > it->second.size()) {
+            return std::unexpected{h2_error_code::internal_error};
+        }
+
+        // A contiguous continuation in the same buffer extends the pinned
+        // tail, keeping the eventual dispatch on the zero-copy path
+        if (!pending_.empty() && pending_.back().id == id &&
+            pending_.back().offset + pending_.back().length == offset) {
+            pending_.back().length += length;
+        } else {
+            pending_.push_back({id, offset, length});
+        }
+        return drain();
+    }
+
+    // Lowest offset of `id` still pinned by an unfinished frame; everything
+    // below it may be recycled. Returns the buffer size once nothing is
+    // pinned.
+    size_t releasable_up_to(uint16_t id) const {
+        for (const auto& s : pending_) {
+            if (s.id == id) {
+                return s.offset;
+            }
+        }
+        auto it = buffers_.find(id);
+        return it != buffers_.end() ? it->second.size() : 0;
+    }
+
+    // Total bytes currently pinned across all registered buffers
+    size_t pending_bytes() const noexcept {
+        size_t total = 0;
+        for (const auto& s : pending_) {
+            total += s.length;
+        }
+        return total;
+    }
+
+private:
+    struct slice {
+        uint16_t id;
+        size_t offset;
+        size_t length;
+    };
+
+    std::span<const uint8_t> memory_of(const slice& s) const {
+        return buffers_.at(s.id).subspan(s.offset, s.length);
+    }
+
+    // Length of the run of whole frames at the start of `data`
+    static size_t whole_frames_prefix(std::span<const uint8_t> data) {
+        size_t pos = 0;
+        while (pos + frame_header::size <= data.size()) {
+            size_t payload_len = (static_cast<size_t>(data[pos]) << 16) |
+                                 (static_cast<size_t>(data[pos + 1]) << 8) |
+                                 static_cast<size_t>(data[pos + 2]);
+            if (pos + frame_header::size + payload_len > data.size()) {
+                break;
+            }
+            pos += frame_header::size + payload_len;
+        }
+        return pos;
+    }
+
+    // Feeds every completed frame to the processor and unpins its bytes
+    std::expected<size_t, h2_error_code> drain() {
+        size_t fed = 0;
+        while (!pending_.empty()) {
+            auto front_mem = memory_of(pending_.front());
+
+            // Whole frames at the front dispatch in place, zero-copy
+            if (size_t run = whole_frames_prefix(front_mem); run > 0) {
+                auto result = processor_->process_frames(front_mem.first(run));
+                if (!result) {
+                    return std::unexpected{result.error()};
+                }
+                fed += run;
+                advance(run);
+                continue;
+            }
+
+            // The next frame extends past the front slice: gather its header
+            // to learn the total size
+            size_t available = pending_bytes();
+            if (available < frame_header::size) {
+                break;
+            }
+            uint8_t header_bytes[frame_header::size];
+            gather(header_bytes, frame_header::size);
+            size_t payload_len = (static_cast<size_t>(header_bytes[0]) << 16) |
+                                 (static_cast<size_t>(header_bytes[1]) << 8) |
+                                 static_cast<size_t>(header_bytes[2]);
+            size_t frame_total = frame_header::size + payload_len;
+
+            // A declared length over the negotiated limit will never fit;
+            // hand the header to the processor so it raises its usual error
+            if (payload_len > processor_->get_stream_manager().get_settings().max_frame_size) {
+                auto result = processor_->process_frames({header_bytes, frame_header::size});
+                return std::unexpected{result ? h2_error_code::frame_size_error : result.error()};
+            }
+
+            if (available < frame_total) {
+                break; // Wait for the rest of the frame
+            }
+
+            // A frame spanning non-contiguous slices is assembled exactly once
+            scratch_.resize(frame_total);
+            gather(scratch_.data(), frame_total);
+            auto result = processor_->process_frames({scratch_.data(), scratch_.size()});
+            if (!result) {
+                return std::unexpected{result.error()};
+            }
+            fed += frame_total;
+            advance(frame_total);
+        }
+        return fed;
+    }
+
+    // Copies the first `count` pinned bytes into `out` without unpinning
+    void gather(uint8_t* out, size_t count) const {
+        for (const auto& s : pending_) {
+            if (count == 0) {
+                break;
+            }
+            size_t take = std::min(count, s.length);
+            std::memcpy(out, memory_of(s).data(), take);
+            out += take;
+            count -= take;
+        }
+    }
+
+    // Unpins the first `count` bytes
+    void advance(size_t count) {
+        while (count > 0) {
+            slice& front = pending_.front();
+            size_t take = std::min(count, front.length);
+            front.offset += take;
+            front.length -= take;
+            count -= take;
+            if (front.length == 0) {
+                pending_.erase(pending_.begin());
+            }
+        }
+    }
+
+    frame_processor* processor_;
+    std::unordered_map<uint16_t, std::span<const uint8_t>> buffers_;
+    std::vector<slice> pending_;
+    std::vector<uint8_t> scratch_;
+};
+
+} // namespace co::http::v2
@@ -1,9 +1,10 @@
 #pragma once
 
 #include "types.hpp"
-#include <unordered_map>
-#include <unordered_set>
+#include <memory>
+#include <optional>
 #include <queue>
+#include <vector>
 #include <algorithm>
 
 namespace co::http::v2 {
@@ -12,28 +13,35 @@ namespace co::http::v2 {
 // HTTP/2 Stream Manager (High Performance)
 // =============================================================================
 
+// Stream storage is a slab of stream_info chunks (stable addresses) indexed
+// by an open-addressing hash table keyed on stream id, so the per-frame
+// get_stream() is one probe sequence over a flat array instead of a
+// node-based map walk. Freed slots are recycled through a freelist with a
+// generation counter bumped on each reuse; closed streams stay queryable
+// (frames on them must report stream_closed, not protocol_error) until
+// enough accumulate to trigger a sweep.
 class stream_manager {
 public:
     stream_manager() = default;
     ~stream_manager() = default;
-    
+
     // Non-copyable, movable
     stream_manager(const stream_manager&) = delete;
     stream_manager& operator=(const stream_manager&) = delete;
     stream_manager(stream_manager&&) = default;
     stream_manager& operator=(stream_manager&&) = default;
-    
+
     // =============================================================================
     // Stream Management
     // =============================================================================
-    
+
     // Create a new stream
     std::expected<stream_info*, h2_error_code> create_stream(uint32_t stream_id, bool is_server = false) {
         // Validate stream ID
         if (stream_id == 0) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         // Check for valid stream ID ordering
         if (is_server) {
             if (stream_id % 2 != 0) { // Server streams must be even
@@ -44,72 +52,69 @@ public:
                 return std::unexpected{h2_error_code::protocol_error};
             }
         }
-        
+
         // Check if stream already exists
-        if (streams_.find(stream_id) != streams_.end()) {
+        if (find_slot(stream_id) != npos) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         // Check stream ID ordering (must be greater than previous)
         if (stream_id <= last_stream_id_) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         // Check concurrent streams limit
-        if (active_streams_.size() >= settings_.max_concurrent_streams) {
+        if (active_count_ >= settings_.max_concurrent_streams) {
             return std::unexpected{h2_error_code::refused_stream};
         }
-        
-        // Create new stream
-        auto [it, inserted] = streams_.emplace(stream_id, stream_info{});
-        if (!inserted) {
-            return std::unexpected{h2_error_code::internal_error};
-        }
-        
-        auto& stream = it->second;
-        stream.id = stream_id;
-        stream.state = stream_state::open;
-        stream.window_size = settings_.initial_window_size;
-        stream.remote_window_size = settings_.initial_window_size;
-        
-        active_streams_.insert(stream_id);
+
+        // Take a slot from the slab and index it
+        uint32_t slot_index = acquire_slot();
+        slot& s = slot_at(slot_index);
+        s.info = stream_info{};
+        s.info.id = stream_id;
+        s.info.state = stream_state::open;
+        s.info.window_size = settings_.initial_window_size;
+        s.info.remote_window_size = settings_.initial_window_size;
+
+        index_insert(stream_id, slot_index);
+        ++active_count_;
         last_stream_id_ = std::max(last_stream_id_, stream_id);
-        
-        return &stream;
+
+        return &s.info;
     }
-    
+
     // Get existing stream
     stream_info* get_stream(uint32_t stream_id) noexcept {
-        auto it = streams_.find(stream_id);
-        return (it != streams_.end()) ? &it->second : nullptr;
+        uint32_t slot_index = find_slot(stream_id);
+        return (slot_index != npos) ? &slot_at(slot_index).info : nullptr;
     }
-    
+
     const stream_info* get_stream(uint32_t stream_id) const noexcept {
-        auto it = streams_.find(stream_id);
-        return (it != streams_.end()) ? &it->second : nullptr;
+        uint32_t slot_index = find_slot(stream_id);
+        return (slot_index != npos) ? &slot_at(slot_index).info : nullptr;
     }
-    
+
     // Close stream
     void close_stream(uint32_t stream_id, h2_error_code error = h2_error_code::no_error) {
-        auto it = streams_.find(stream_id);
-        if (it != streams_.end()) {
-            it->second.state = stream_state::closed;
-            it->second.error = error;
-            it->second.local_closed = true;
-            it->second.remote_closed = true;
-            
-            active_streams_.erase(stream_id);
-            
-            // Add to cleanup queue for deferred cleanup
-            cleanup_queue_.push(stream_id);
-            
-            // Perform cleanup if queue is getting large
-            if (cleanup_queue_.size() > max_cleanup_queue_size_) {
+        auto* stream = get_stream(stream_id);
+        if (stream) {
+            if (!stream->is_closed()) {
+                --active_count_;
+                ++closed_count_;
+            }
+            stream->state = stream_state::closed;
+            stream->error = error;
+            stream->local_closed = true;
+            stream->remote_closed = true;
+
+            // Sweep once enough closed streams have accumulated
+            if (closed_count_ > max_closed_streams_) {
                 cleanup_closed_streams();
             }
         }
     }
-    
+
     // Half-close stream
     void half_close_stream_local(uint32_t stream_id) {
         auto* stream = get_stream(stream_id);
@@ -119,11 +124,12 @@ public:
                 stream->state = stream_state::half_closed_local;
             } else if (stream->state == stream_state::half_closed_remote) {
                 stream->state = stream_state::closed;
-                active_streams_.erase(stream_id);
+                --active_count_;
+                ++closed_count_;
             }
         }
     }
-    
+
     void half_close_stream_remote(uint32_t stream_id) {
         auto* stream = get_stream(stream_id);
         if (stream) {
@@ -132,204 +138,475 @@ public:
                 stream->state = stream_state::half_closed_remote;
             } else if (stream->state == stream_state::half_closed_local) {
                 stream->state = stream_state::closed;
-                active_streams_.erase(stream_id);
+                --active_count_;
+                ++closed_count_;
             }
         }
     }
-    
+
     // =============================================================================
     // Flow Control
     // =============================================================================
-    
+
     // Update stream window size
     std::expected<void, h2_error_code> update_stream_window(uint32_t stream_id, int32_t delta) {
         auto* stream = get_stream(stream_id);
         if (!stream) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         // Check for overflow
         int64_t new_window = static_cast<int64_t>(stream->window_size) + delta;
         if (new_window > protocol_limits::max_window_size || new_window < 0) {
             return std::unexpected{h2_error_code::flow_control_error};
         }
-        
+
         stream->window_size = static_cast<int32_t>(new_window);
         return {};
     }
-    
+
     // Update remote stream window size
     std::expected<void, h2_error_code> update_remote_stream_window(uint32_t stream_id, int32_t delta) {
         auto* stream = get_stream(stream_id);
         if (!stream) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         int64_t new_window = static_cast<int64_t>(stream->remote_window_size) + delta;
         if (new_window > protocol_limits::max_window_size || new_window < 0) {
             return std::unexpected{h2_error_code::flow_control_error};
         }
-        
+
         stream->remote_window_size = static_cast<int32_t>(new_window);
         return {};
     }
-    
+
     // Consume stream window for outgoing data
     std::expected<uint32_t, h2_error_code> consume_stream_window(uint32_t stream_id, uint32_t size) {
         auto* stream = get_stream(stream_id);
         if (!stream) {
             return std::unexpected{h2_error_code::protocol_error};
         }
-        
+
         if (!stream->can_send_data()) {
             return std::unexpected{h2_error_code::stream_closed};
         }
-        
+
         // Calculate available window size
         uint32_t available = std::min(
             static_cast<uint32_t>(std::max(0, stream->window_size)),
             static_cast<uint32_t>(std::max(0, settings_.connection_window_size))
         );
-        
+
         uint32_t to_consume = std::min(size, available);
-        
+
         if (to_consume > 0) {
             stream->window_size -= to_consume;
             settings_.connection_window_size -= to_consume;
         }
-        
+
         return to_consume;
     }
-    
+
     // =============================================================================
     // Priority Management
     // =============================================================================
-    
+
     void set_stream_priority(uint32_t stream_id, uint32_t dependency, uint8_t weight, bool exclusive) {
         auto* stream = get_stream(stream_id);
         if (stream) {
             stream->dependency = dependency;
             stream->weight = weight;
             stream->exclusive = exclusive;
-            
-            // TODO: Implement priority tree reordering for performance
-            rebuild_priority_tree();
         }
     }
-    
+
+    // =============================================================================
+    // Outbound Priority Scheduling
+    // =============================================================================
+    //
+    // Weighted fair queuing over the RFC 7540 stream weights: each writable
+    // stream carries a virtual send time advanced by bytes/weight, and the
+    // scheduler always serves the earliest one, so a weight-32 stream gets
+    // twice the bandwidth of a weight-16 stream while small high-priority
+    // responses are not starved behind bulk transfers.
+
+    // Queues the stream for outbound DATA scheduling (it has pending data)
+    void mark_stream_writable(uint32_t stream_id) {
+        uint32_t slot_index = find_slot(stream_id);
+        if (slot_index == npos) {
+            return;
+        }
+        slot& s = slot_at(slot_index);
+        if (s.writable || s.info.is_closed()) {
+            return;
+        }
+        s.writable = true;
+        // A stream returning from idle resumes at the current service point
+        // instead of claiming credit for the time it was absent
+        s.vtime = std::max(s.vtime, min_active_vtime_);
+        ready_queue_.push({s.vtime, stream_id});
+    }
+
+    // Removes the stream from scheduling (no more pending data)
+    void mark_stream_unwritable(uint32_t stream_id) {
+        uint32_t slot_index = find_slot(stream_id);
+        if (slot_index != npos) {
+            slot_at(slot_index).writable = false;
+        }
+    }
+
+    // The writable stream with the earliest weighted virtual time whose
+    // flow-control windows admit data, or nullopt when everything is idle
+    // or blocked. O(log n) per pick; window-blocked streams are skipped but
+    // stay queued.
+    std::optional<uint32_t> next_writable_stream() {
+        if (settings_.connection_window_size <= 0) {
+            return std::nullopt;
+        }
+
+        std::optional<uint32_t> picked;
+        std::vector<sched_entry> window_blocked;
+        while (!ready_queue_.empty()) {
+            sched_entry entry = ready_queue_.top();
+            uint32_t slot_index = find_slot(entry.stream_id);
+            if (slot_index == npos) {
+                ready_queue_.pop(); // Stream is gone, drop the stale entry
+                continue;
+            }
+            slot& s = slot_at(slot_index);
+            if (!s.writable || s.vtime != entry.vtime) {
+                ready_queue_.pop(); // Superseded by a fresher entry
+                continue;
+            }
+            if (s.info.is_closed() || s.info.is_half_closed_local()) {
+                s.writable = false;
+                ready_queue_.pop();
+                continue;
+            }
+            if (s.info.window_size <= 0) {
+                // Flow-control blocked: step over it for now, requeue after
+                ready_queue_.pop();
+                window_blocked.push_back(entry);
+                continue;
+            }
+            min_active_vtime_ = entry.vtime;
+            picked = entry.stream_id;
+            break;
+        }
+
+        for (const sched_entry& entry : window_blocked) {
+            ready_queue_.push(entry);
+        }
+        return picked;
+    }
+
+    // Accounts bytes actually sent on the stream, advancing its virtual
+    // time inversely to its weight and re-queuing it for the next round
+    void record_data_sent(uint32_t stream_id, size_t bytes) {
+        uint32_t slot_index = find_slot(stream_id);
+        if (slot_index == npos) {
+            return;
+        }
+        slot& s = slot_at(slot_index);
+        // weight is 0-255 for an effective 1-256 (RFC 7540 Section 5.3.2)
+        uint64_t effective_weight = static_cast<uint64_t>(s.info.weight) + 1;
+        uint64_t delta = (static_cast<uint64_t>(bytes) * 256) / effective_weight;
+        s.vtime += std::max<uint64_t>(delta, 1);
+        if (s.writable) {
+            ready_queue_.push({s.vtime, stream_id});
+        }
+    }
+
     std::vector<uint32_t> get_prioritized_streams() const {
         std::vector<uint32_t> result;
-        result.reserve(active_streams_.size());
-        
-        // Simple priority implementation - can be optimized with proper priority tree
-        for (uint32_t stream_id : active_streams_) {
-            const auto* stream = get_stream(stream_id);
-            if (stream && stream->can_send_data()) {
-                result.push_back(stream_id);
+        result.reserve(active_count_);
+
+        for_each_stream([&](const stream_info& stream) {
+            if (!stream.is_closed() && stream.can_send_data()) {
+                result.push_back(stream.id);
             }
-        }
-        
+        });
+
         // Sort by weight (higher weight = higher priority)
         std::sort(result.begin(), result.end(), [this](uint32_t a, uint32_t b) {
             const auto* stream_a = get_stream(a);
             const auto* stream_b = get_stream(b);
             return stream_a->weight > stream_b->weight;
         });
-        
+
         return result;
     }
-    
+
     // =============================================================================
     // Settings Management
     // =============================================================================
-    
+
     void update_settings(const connection_settings& new_settings) {
         // Update window sizes for existing streams when initial window size changes
         if (new_settings.initial_window_size != settings_.initial_window_size) {
-            int32_t delta = static_cast<int32_t>(new_settings.initial_window_size) - 
+            int32_t delta = static_cast<int32_t>(new_settings.initial_window_size) -
                            static_cast<int32_t>(settings_.initial_window_size);
-            
-            for (auto& [stream_id, stream] : streams_) {
+
+            for_each_stream([delta](stream_info& stream) {
                 int64_t new_window = static_cast<int64_t>(stream.window_size) + delta;
                 // Clamp to valid range
                 stream.window_size = static_cast<int32_t>(
                     std::max(static_cast<int64_t>(INT32_MIN),
                     std::min(static_cast<int64_t>(protocol_limits::max_window_size), new_window))
                 );
-            }
+            });
         }
-        
+
         settings_ = new_settings;
     }
-    
+
     const connection_settings& get_settings() const noexcept {
         return settings_;
     }
-    
+
     // =============================================================================
     // Statistics and Monitoring
     // =============================================================================
-    
+
     size_t active_stream_count() const noexcept {
-        return active_streams_.size();
+        return active_count_;
     }
-    
+
     size_t total_stream_count() const noexcept {
-        return streams_.size();
+        return live_count_;
     }
-    
+
     uint32_t get_last_stream_id() const noexcept {
         return last_stream_id_;
     }
-    
+
     std::vector<uint32_t> get_active_stream_ids() const {
-        return std::vector<uint32_t>(active_streams_.begin(), active_streams_.end());
+        std::vector<uint32_t> result;
+        result.reserve(active_count_);
+        for_each_stream([&](const stream_info& stream) {
+            if (!stream.is_closed()) {
+                result.push_back(stream.id);
+            }
+        });
+        return result;
     }
-    
+
     // =============================================================================
     // Cleanup and Maintenance
     // =============================================================================
-    
+
     void cleanup_closed_streams() {
-        while (!cleanup_queue_.empty()) {
-            uint32_t stream_id = cleanup_queue_.front();
-            cleanup_queue_.pop();
-            
-            auto it = streams_.find(stream_id);
-            if (it != streams_.end() && it->second.is_closed()) {
-                streams_.erase(it);
+        for (uint32_t slot_index = 0; slot_index < slot_count_; ++slot_index) {
+            slot& s = slot_at(slot_index);
+            if (s.in_use && s.info.is_closed()) {
+                index_erase(s.info.id);
+                release_slot(slot_index);
             }
         }
+        closed_count_ = 0;
     }
-    
+
     void reset() {
-        streams_.clear();
-        active_streams_.clear();
-        while (!cleanup_queue_.empty()) {
-            cleanup_queue_.pop();
-        }
+        slab_.clear();
+        free_slots_.clear();
+        slot_count_ = 0;
+        index_.clear();
+        index_live_ = 0;
+        index_used_ = 0;
+        active_count_ = 0;
+        closed_count_ = 0;
+        live_count_ = 0;
+        ready_queue_ = {};
+        min_active_vtime_ = 0;
         last_stream_id_ = 0;
         settings_ = connection_settings{};
     }
-    
+
 private:
+    static constexpr uint32_t npos = UINT32_MAX;
+    static constexpr size_t slab_chunk_size = 64;
+
+    // One slab slot; the generation counter advances on every reuse so a
+    // recycled slot is distinguishable from the stream that previously
+    // occupied it
+    struct slot {
+        stream_info info{};
+        uint32_t generation = 0;
+        bool in_use = false;
+
+        // Scheduling state: weighted virtual send time and whether the
+        // stream currently has pending outbound data
+        uint64_t vtime = 0;
+        bool writable = false;
+    };
+
+    // Min-heap entry for the ready queue; a slot's vtime moving on makes
+    // older entries stale (lazy deletion)
+    struct sched_entry {
+        uint64_t vtime;
+        uint32_t stream_id;
+        bool operator>(const sched_entry& other) const noexcept {
+            return vtime != other.vtime ? vtime > other.vtime
+                                        : stream_id > other.stream_id;
+        }
+    };
+
+    // Open-addressing index entry mapping stream id -> slab slot
+    struct index_entry {
+        enum class slot_state : uint8_t { empty, occupied, tombstone };
+        uint32_t stream_id = 0;
+        uint32_t slot_index = 0;
+        slot_state state = slot_state::empty;
+    };
+
+    slot& slot_at(uint32_t slot_index) noexcept {
+        return slab_[slot_index / slab_chunk_size][slot_index % slab_chunk_size];
+    }
+
+    const slot& slot_at(uint32_t slot_index) const noexcept {
+        return slab_[slot_index / slab_chunk_size][slot_index % slab_chunk_size];
+    }
+
+    static size_t hash_id(uint32_t stream_id, size_t mask) noexcept {
+        // Fibonacci hashing spreads the mostly-sequential stream ids
+        return (stream_id * 2654435761u) & mask;
+    }
+
+    uint32_t find_slot(uint32_t stream_id) const noexcept {
+        if (index_.empty()) {
+            return npos;
+        }
+        size_t mask = index_.size() - 1;
+        size_t pos = hash_id(stream_id, mask);
+        while (index_[pos].state != index_entry::slot_state::empty) {
+            if (index_[pos].state == index_entry::slot_state::occupied &&
+                index_[pos].stream_id == stream_id) {
+                return index_[pos].slot_index;
+            }
+            pos = (pos + 1) & mask;
+        }
+        return npos;
+    }
+
+    void index_insert(uint32_t stream_id, uint32_t slot_index) {
+        // Keep the probe sequences short: grow at 70% load (tombstones count)
+        if (index_.empty() || (index_used_ + 1) * 10 > index_.size() * 7) {
+            grow_index();
+        }
+        size_t mask = index_.size() - 1;
+        size_t pos = hash_id(stream_id, mask);
+        while (index_[pos].state == index_entry::slot_state::occupied) {
+            pos = (pos + 1) & mask;
+        }
+        if (index_[pos].state == index_entry::slot_state::empty) {
+            ++index_used_;
+        }
+        index_[pos] = {stream_id, slot_index, index_entry::slot_state::occupied};
+        ++index_live_;
+        ++live_count_;
+    }
+
+    void index_erase(uint32_t stream_id) noexcept {
+        size_t mask = index_.size() - 1;
+        size_t pos = hash_id(stream_id, mask);
+        while (index_[pos].state != index_entry::slot_state::empty) {
+            if (index_[pos].state == index_entry::slot_state::occupied &&
+                index_[pos].stream_id == stream_id) {
+                index_[pos].state = index_entry::slot_state::tombstone;
+                --index_live_;
+                --live_count_;
+                return;
+            }
+            pos = (pos + 1) & mask;
+        }
+    }
+
+    void grow_index() {
+        size_t new_size = index_.empty() ? 64 : index_.size() * 2;
+        std::vector<index_entry> old = std::move(index_);
+        index_.assign(new_size, index_entry{});
+        index_used_ = 0;
+        size_t mask = new_size - 1;
+        for (const index_entry& entry : old) {
+            if (entry.state == index_entry::slot_state::occupied) {
+                size_t pos = hash_id(entry.stream_id, mask);
+                while (index_[pos].state == index_entry::slot_state::occupied) {
+                    pos = (pos + 1) & mask;
+                }
+                index_[pos] = entry;
+                ++index_used_;
+            }
+        }
+    }
+
+    uint32_t acquire_slot() {
+        if (!free_slots_.empty()) {
+            uint32_t slot_index = free_slots_.back();
+            free_slots_.pop_back();
+            slot_at(slot_index).in_use = true;
+            return slot_index;
+        }
+        if (slot_count_ % slab_chunk_size == 0) {
+            slab_.push_back(std::make_unique<slot[]>(slab_chunk_size));
+        }
+        uint32_t slot_index = static_cast<uint32_t>(slot_count_++);
+        slot_at(slot_index).in_use = true;
+        return slot_index;
+    }
+
+    void release_slot(uint32_t slot_index) {
+        slot& s = slot_at(slot_index);
+        s.in_use = false;
+        s.writable = false;
+        s.vtime = 0;
+        ++s.generation;
+        free_slots_.push_back(slot_index);
+    }
+
+    template <typename Fn>
+    void for_each_stream(Fn&& fn) {
+        for (uint32_t slot_index = 0; slot_index < slot_count_; ++slot_index) {
+            slot& s = slot_at(slot_index);
+            if (s.in_use) {
+                fn(s.info);
+            }
+        }
+    }
+
+    template <typename Fn>
+    void for_each_stream(Fn&& fn) const {
+        for (uint32_t slot_index = 0; slot_index < slot_count_; ++slot_index) {
+            const slot& s = slot_at(slot_index);
+            if (s.in_use) {
+                fn(s.info);
+            }
+        }
+    }
+
     // Stream storage
-    std::unordered_map<uint32_t, stream_info> streams_;
-    std::unordered_set<uint32_t> active_streams_;
-    std::queue<uint32_t> cleanup_queue_;
-    
+    std::vector<std::unique_ptr<slot[]>> slab_;
+    std::vector<uint32_t> free_slots_;
+    size_t slot_count_ = 0;
+
+    std::vector<index_entry> index_;
+    size_t index_live_ = 0;
+    size_t index_used_ = 0; // occupied + tombstones, drives growth
+
+    size_t active_count_ = 0;
+    size_t closed_count_ = 0;
+    size_t live_count_ = 0;
+
+    // Outbound scheduling
+    std::priority_queue<sched_entry, std::vector<sched_entry>, std::greater<>> ready_queue_;
+    uint64_t min_active_vtime_ = 0;
+
     // Connection state
     connection_settings settings_;
     uint32_t last_stream_id_ = 0;
-    
+
     // Performance tuning
-    static constexpr size_t max_cleanup_queue_size_ = 100;
-    
-    // Priority tree management
-    void rebuild_priority_tree() {
-        // TODO: Implement efficient priority tree for high-performance scheduling
-        // This is a simplified implementation
-    }
+    static constexpr size_t max_closed_streams_ = 100;
 };
 
-} // namespace co::http::v2
\ No newline at end of file
+} // namespace co::http::v2
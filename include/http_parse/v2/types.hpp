@@ -201,6 +201,10 @@ struct stream_info {
     bool data_complete = false;
     bool local_closed = false;
     bool remote_closed = false;
+
+    // Received DATA bytes consumed by the application but not yet credited
+    // back with a WINDOW_UPDATE (see frame_processor::consume_data)
+    uint32_t unacked_consumed = 0;
     
     // Error tracking
     h2_error_code error = h2_error_code::no_error;
@@ -284,6 +288,36 @@ struct connection_settings {
                 return true; // Unknown settings are ignored
         }
     }
+
+    // HTTP/2 defines exactly six setting ids, so a fixed array always holds
+    // a full serialization
+    static constexpr size_t max_settings = 6;
+
+    // Writes the settings that differ from their RFC 7540 defaults into
+    // `out` as {id, value} pairs and returns the count. Peers assume the
+    // defaults, so only deviations need to go on the wire; with `out` sized
+    // max_settings this never overflows and never allocates.
+    size_t serialize_nondefault(std::span<setting> out) const noexcept {
+        size_t count = 0;
+        auto emit = [&](settings_id id, uint32_t value, uint32_t default_value) {
+            if (value != default_value && count < out.size()) {
+                out[count++] = {static_cast<uint16_t>(id), value};
+            }
+        };
+        emit(settings_id::header_table_size, header_table_size,
+             settings_frame::default_header_table_size);
+        emit(settings_id::enable_push, enable_push ? 1 : 0,
+             settings_frame::default_enable_push);
+        emit(settings_id::max_concurrent_streams, max_concurrent_streams,
+             settings_frame::default_max_concurrent_streams);
+        emit(settings_id::initial_window_size, initial_window_size,
+             settings_frame::default_initial_window_size);
+        emit(settings_id::max_frame_size, max_frame_size,
+             settings_frame::default_max_frame_size);
+        emit(settings_id::max_header_list_size, max_header_list_size,
+             settings_frame::default_max_header_list_size);
+        return count;
+    }
 };
 
 } // namespace co::http::v2
\ No newline at end of file
@@ -5,9 +5,16 @@
 #include <chrono>
 #include <random>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <numeric>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 using namespace co::http;
 using namespace std::chrono;
 
@@ -523,6 +530,229 @@ TEST_F(BenchmarkTest, CompressionRatioBenchmark) {
     
     // HPACK应该提供良好的压缩比
     EXPECT_GT(compression_ratio, 2.0); // 至少2:1的压缩比
+
+    // 各indexing_policy的压缩比对比：首次编码 vs 动态表预热后
+    std::cout << "\n=== HPACK Indexing Policy Comparison ===" << std::endl;
+    struct policy_case {
+        const char* name;
+        detail::hpack_encoder::indexing_policy policy;
+    };
+    const policy_case cases[] = {
+        {"throughput", detail::hpack_encoder::indexing_policy::throughput},
+        {"ratio", detail::hpack_encoder::indexing_policy::ratio},
+        {"adaptive", detail::hpack_encoder::indexing_policy::adaptive},
+    };
+    for (const auto& c : cases) {
+        detail::hpack_encoder policy_encoder;
+        policy_encoder.set_indexing_policy(c.policy);
+
+        output_buffer cold_buffer;
+        ASSERT_TRUE(policy_encoder.encode_headers(typical_headers, cold_buffer).has_value());
+        output_buffer warm_buffer;
+        ASSERT_TRUE(policy_encoder.encode_headers(typical_headers, warm_buffer).has_value());
+
+        std::cout << std::left << std::setw(12) << c.name
+                  << " cold: " << std::setw(4) << cold_buffer.size() << " bytes ("
+                  << std::fixed << std::setprecision(2)
+                  << static_cast<double>(raw_size) / cold_buffer.size() << ":1)"
+                  << "  warm: " << std::setw(4) << warm_buffer.size() << " bytes ("
+                  << static_cast<double>(raw_size) / warm_buffer.size() << ":1)"
+                  << std::endl;
+    }
+}
+
+// =============================================================================
+// 多核扩展性测试
+// =============================================================================
+
+namespace {
+
+// 将当前线程绑定到指定核心（仅Linux，其他平台为空操作），
+// 避免迁移和超线程配对干扰扩展性数据
+void PinToCore(unsigned core) {
+#if defined(__linux__)
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % hw, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+// 在1/2/4/8/16个绑核线程上运行同一负载，报告单核/聚合吞吐量
+// 与扩展效率（聚合吞吐 / 单线程吞吐 × 线程数）。
+// make_workload(t) 为线程t构造独享状态并返回每次迭代的可调用对象。
+template <typename WorkloadFactory>
+void RunScalingSuite(const std::string& name, int iterations_per_thread,
+                     WorkloadFactory make_workload) {
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    double single_thread_ops = 0.0;
+
+    std::cout << "\n=== " << name << " scaling ===" << std::endl;
+    for (int num_threads : {1, 2, 4, 8, 16}) {
+        if (static_cast<unsigned>(num_threads) > hw) {
+            std::cout << "  " << num_threads << " threads: skipped (only "
+                      << hw << " cores)" << std::endl;
+            continue;
+        }
+
+        std::vector<double> thread_ops(num_threads, 0.0);
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                PinToCore(static_cast<unsigned>(t));
+                auto work = make_workload(t);
+                ready.fetch_add(1, std::memory_order_release);
+                while (!go.load(std::memory_order_acquire)) {
+                    // 所有线程同时起跑，避免先启动的线程独占测量窗口
+                }
+                auto start = high_resolution_clock::now();
+                for (int i = 0; i < iterations_per_thread; ++i) {
+                    work(i);
+                }
+                auto end = high_resolution_clock::now();
+                auto us = duration_cast<microseconds>(end - start).count();
+                thread_ops[t] = iterations_per_thread / (us / 1000000.0);
+            });
+        }
+        while (ready.load(std::memory_order_acquire) < num_threads) {
+            std::this_thread::yield();
+        }
+        go.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        double aggregate = std::accumulate(thread_ops.begin(), thread_ops.end(), 0.0);
+        if (num_threads == 1) {
+            single_thread_ops = aggregate;
+        }
+        double efficiency = aggregate / (single_thread_ops * num_threads) * 100.0;
+        std::cout << "  " << num_threads << " threads: "
+                  << std::fixed << std::setprecision(0)
+                  << aggregate << " ops/s aggregate, "
+                  << aggregate / num_threads << " ops/s per core, "
+                  << std::setprecision(1) << efficiency << "% efficiency"
+                  << std::endl;
+    }
+}
+
+} // namespace
+
+TEST_F(BenchmarkTest, MultiCoreParseScalingBenchmark) {
+    auto test_requests = CreateTestRequests(100);
+
+    // 每线程独享parser（shared-nothing），理想情况应接近线性扩展
+    RunScalingSuite("HTTP/1 Parse", 20000, [&](int) {
+        return [&, p = std::make_shared<parser>(version::http_1_1)](int i) {
+            const std::string& data = test_requests[i % test_requests.size()];
+            auto result = p->parse_request(data);
+            ASSERT_TRUE(result.has_value());
+            p->reset();
+        };
+    });
+}
+
+TEST_F(BenchmarkTest, MultiCoreEncodeScalingBenchmark) {
+    RunScalingSuite("HTTP/1 Encode", 20000, [&](int t) {
+        request req;
+        req.method_type = method::get;
+        req.target = "/api/data/" + std::to_string(t);
+        req.protocol_version = version::http_1_1;
+        req.headers = {{"host", "api.example.com"},
+                       {"user-agent", "BenchmarkClient/1.0"},
+                       {"accept", "application/json"}};
+        return [req = std::move(req), buffer = std::make_shared<output_buffer>()](int) {
+            buffer->clear();
+            auto result = http1::encode_request(req, *buffer);
+            ASSERT_TRUE(result.has_value());
+        };
+    });
+}
+
+TEST_F(BenchmarkTest, MultiCoreHpackScalingBenchmark) {
+    std::vector<std::vector<header>> header_sets;
+    for (int i = 0; i < 50; ++i) {
+        header_sets.push_back({{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/api/data/" + std::to_string(i)},
+                               {":authority", "api.example.com"},
+                               {"accept", "application/json"},
+                               {"x-request-id", "req_" + std::to_string(i)}});
+    }
+
+    RunScalingSuite("HPACK Encode+Decode", 10000, [&](int) {
+        auto enc = std::make_shared<detail::hpack_encoder>();
+        auto dec = std::make_shared<detail::hpack_decoder>();
+        return [&, enc, dec](int i) {
+            const auto& headers = header_sets[i % header_sets.size()];
+            output_buffer buffer(1024);
+            auto encoded = enc->encode_headers(headers, buffer);
+            ASSERT_TRUE(encoded.has_value());
+            auto decoded = dec->decode_headers(buffer.span());
+            ASSERT_TRUE(decoded.has_value());
+        };
+    });
+}
+
+TEST_F(BenchmarkTest, FalseSharingCounterLayoutBenchmark) {
+    // frame_processor::stats_ 这类逐字段相邻排布的计数器，被多个线程
+    // 各自递增时会落在同一缓存行上互相乒乓。对比相邻排布与按缓存行
+    // 填充的排布，量化这种布局的代价。
+    constexpr int kMaxThreads = 16;
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const int num_threads = static_cast<int>(std::min(4u, hw));
+    const int iterations = 2000000;
+
+    struct padded_counter {
+        alignas(64) std::atomic<uint64_t> value{0};
+    };
+    static std::array<std::atomic<uint64_t>, kMaxThreads> adjacent{};
+    static std::array<padded_counter, kMaxThreads> isolated{};
+
+    auto run = [&](auto& counters) {
+        auto start = high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                PinToCore(static_cast<unsigned>(t));
+                for (int i = 0; i < iterations; ++i) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(counters[0])>,
+                                                 padded_counter>) {
+                        counters[t].value.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        counters[t].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto end = high_resolution_clock::now();
+        return static_cast<double>(duration_cast<microseconds>(end - start).count());
+    };
+
+    double adjacent_us = run(adjacent);
+    double isolated_us = run(isolated);
+    double slowdown = adjacent_us / isolated_us;
+
+    std::cout << "\n=== False Sharing Counter Layout (" << num_threads
+              << " threads) ===" << std::endl;
+    std::cout << "Adjacent counters: " << std::fixed << std::setprecision(0)
+              << adjacent_us << " μs" << std::endl;
+    std::cout << "Cacheline-padded counters: " << isolated_us << " μs" << std::endl;
+    std::cout << "Adjacent-layout slowdown: " << std::setprecision(2)
+              << slowdown << "x" << std::endl;
+
+    // 单线程环境下两者应相当；多核下相邻布局通常明显更慢。
+    // 这里只做合理性校验，不对倍数设阈值以免在受限环境中抖动。
+    EXPECT_GT(adjacent_us, 0.0);
+    EXPECT_GT(isolated_us, 0.0);
 }
 
 // =============================================================================
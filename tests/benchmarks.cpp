@@ -0,0 +1,300 @@
+#include <benchmark/benchmark.h>
+#include "http_parse.hpp"
+#include <string>
+#include <vector>
+
+using namespace co::http;
+
+// =============================================================================
+// Google Benchmark 微基准测试
+//
+// 与 benchmark_tests.cpp 中的手工计时循环不同，这里由 google/benchmark
+// 控制迭代次数并做统计稳定性处理，输出 ns/op 与 bytes/sec。
+// CI 中用 --benchmark_format=json --benchmark_out=bench.json 导出结果，
+// 便于跨提交 diff；本地直接运行可读表格输出。
+// =============================================================================
+
+namespace {
+
+// 生成一组典型的 HTTP/1.1 请求报文
+std::vector<std::string> MakeTestRequests(int count) {
+    static const char* methods[] = {"GET", "POST", "PUT", "DELETE", "HEAD"};
+    static const char* paths[] = {"/", "/api/users", "/api/data", "/upload", "/download"};
+    static const char* hosts[] = {"api.example.com", "www.example.com", "cdn.example.com"};
+
+    std::vector<std::string> requests;
+    requests.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        std::string request =
+            std::string(methods[i % 5]) + " " + paths[i % 5] + "/" + std::to_string(i) + " HTTP/1.1\r\n"
+            "Host: " + hosts[i % 3] + "\r\n"
+            "User-Agent: BenchmarkClient/1.0\r\n"
+            "Accept: application/json\r\n"
+            "Connection: keep-alive\r\n"
+            "\r\n";
+        requests.push_back(std::move(request));
+    }
+    return requests;
+}
+
+// 生成一组典型的请求头集合（与 HpackCompressionBenchmark 场景一致）
+std::vector<std::vector<header>> MakeHeaderSets(int count) {
+    std::vector<std::vector<header>> header_sets;
+    header_sets.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        header_sets.push_back({
+            {":method", "GET"},
+            {":scheme", "https"},
+            {":path", "/api/data/" + std::to_string(i)},
+            {":authority", "api.example.com"},
+            {"user-agent", "Mozilla/5.0 (compatible; BenchmarkClient/1.0)"},
+            {"accept", "application/json"},
+            {"accept-language", "en-US,en;q=0.9"},
+            {"accept-encoding", "gzip, deflate, br"},
+            {"x-request-id", "req_" + std::to_string(i)}
+        });
+    }
+    return header_sets;
+}
+
+// 构造一个 DATA 帧（9 字节帧头 + 负载）
+std::vector<uint8_t> MakeDataFrame(uint32_t stream_id, const std::string& data) {
+    std::vector<uint8_t> frame(v2::frame_header::size + data.size());
+    v2::frame_header header{};
+    header.length = static_cast<uint32_t>(data.size());
+    header.type = static_cast<uint8_t>(v2::frame_type::data);
+    header.flags = 0;
+    header.stream_id = stream_id;
+    header.serialize(frame.data());
+    std::copy(data.begin(), data.end(), frame.begin() + v2::frame_header::size);
+    return frame;
+}
+
+// =============================================================================
+// HTTP/1.x 解析
+// =============================================================================
+
+void BM_Http1ParseRequest(benchmark::State& state) {
+    auto requests = MakeTestRequests(100);
+    size_t index = 0;
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        const std::string& request = requests[index++ % requests.size()];
+        auto result = http1::parse_request(request);
+        benchmark::DoNotOptimize(result);
+        bytes += request.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Http1ParseRequest);
+
+void BM_Http1ParseResponse(benchmark::State& state) {
+    std::vector<std::string> responses;
+    for (int i = 0; i < 100; ++i) {
+        std::string body = R"({"id": )" + std::to_string(i) + R"(, "name": "user)" + std::to_string(i) + R"("})";
+        responses.push_back(
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: application/json\r\n"
+            "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            "Server: BenchmarkServer/1.0\r\n"
+            "\r\n" + body);
+    }
+    size_t index = 0;
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        const std::string& response = responses[index++ % responses.size()];
+        auto result = http1::parse_response(response);
+        benchmark::DoNotOptimize(result);
+        bytes += response.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Http1ParseResponse);
+
+// 大报文解析，range 参数为 body 字节数
+void BM_Http1ParseLargeBody(benchmark::State& state) {
+    const size_t body_size = static_cast<size_t>(state.range(0));
+    std::string large_body(body_size, 'X');
+    std::string request =
+        "POST /api/large-upload HTTP/1.1\r\n"
+        "Host: upload.example.com\r\n"
+        "Content-Type: application/octet-stream\r\n"
+        "Content-Length: " + std::to_string(large_body.size()) + "\r\n"
+        "\r\n" + large_body;
+
+    for (auto _ : state) {
+        auto result = http1::parse_request(request);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(request.size()));
+}
+BENCHMARK(BM_Http1ParseLargeBody)->Arg(16 * 1024)->Arg(256 * 1024)->Arg(1024 * 1024);
+
+// =============================================================================
+// HTTP/1.x 编码
+// =============================================================================
+
+void BM_Http1EncodeRequest(benchmark::State& state) {
+    std::vector<request> requests;
+    for (int i = 0; i < 100; ++i) {
+        request req;
+        req.method_type = static_cast<method>(static_cast<int>(method::get) + (i % 5));
+        req.target = "/api/endpoint/" + std::to_string(i);
+        req.protocol_version = version::http_1_1;
+        req.headers = {
+            {"host", "api.example.com"},
+            {"user-agent", "BenchmarkClient/1.0"},
+            {"accept", "application/json"},
+            {"x-request-id", "req_" + std::to_string(i)}
+        };
+        requests.push_back(std::move(req));
+    }
+    size_t index = 0;
+    size_t bytes = 0;
+    output_buffer buffer(1024);
+
+    for (auto _ : state) {
+        buffer.clear();
+        const request& req = requests[index++ % requests.size()];
+        auto result = http1::encode_request(req, buffer);
+        benchmark::DoNotOptimize(result);
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Http1EncodeRequest);
+
+void BM_Http1EncodeResponse(benchmark::State& state) {
+    std::vector<response> responses;
+    for (int i = 0; i < 100; ++i) {
+        response resp;
+        resp.protocol_version = version::http_1_1;
+        resp.status_code = 200;
+        resp.reason_phrase = "OK";
+        resp.headers = {
+            {"content-type", "application/json"},
+            {"server", "BenchmarkServer/1.0"},
+            {"x-response-id", "resp_" + std::to_string(i)}
+        };
+        resp.body = R"({"id": )" + std::to_string(i) + R"(, "data": "response_data"})";
+        responses.push_back(std::move(resp));
+    }
+    size_t index = 0;
+    size_t bytes = 0;
+    output_buffer buffer(1024);
+
+    for (auto _ : state) {
+        buffer.clear();
+        const response& resp = responses[index++ % responses.size()];
+        auto result = http1::encode_response(resp, buffer);
+        benchmark::DoNotOptimize(result);
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Http1EncodeResponse);
+
+// =============================================================================
+// HPACK 压缩/解压
+// =============================================================================
+
+void BM_HpackEncode(benchmark::State& state) {
+    auto header_sets = MakeHeaderSets(100);
+    detail::hpack_encoder encoder;
+    output_buffer buffer(1024);
+    size_t index = 0;
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        buffer.clear();
+        auto result = encoder.encode_headers(header_sets[index++ % header_sets.size()], buffer);
+        benchmark::DoNotOptimize(result);
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HpackEncode);
+
+void BM_HpackEncodeDecode(benchmark::State& state) {
+    auto header_sets = MakeHeaderSets(100);
+    detail::hpack_encoder encoder;
+    detail::hpack_decoder decoder;
+    output_buffer buffer(1024);
+    size_t index = 0;
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        buffer.clear();
+        const auto& headers = header_sets[index++ % header_sets.size()];
+        auto encode_result = encoder.encode_headers(headers, buffer);
+        benchmark::DoNotOptimize(encode_result);
+        auto decode_result = decoder.decode_headers(buffer.span());
+        benchmark::DoNotOptimize(decode_result);
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HpackEncodeDecode);
+
+// =============================================================================
+// HTTP/2 帧处理
+// =============================================================================
+
+void BM_Http2ProcessDataFrames(benchmark::State& state) {
+    // setup 不计时：构造处理器、打开流、准备一串背靠背 DATA 帧
+    std::vector<uint8_t> wire;
+    for (int i = 0; i < 100; ++i) {
+        auto frame = MakeDataFrame(1, "HTTP/2 frame data " + std::to_string(i));
+        wire.insert(wire.end(), frame.begin(), frame.end());
+    }
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v2::frame_processor processor;
+        processor.get_stream_manager().create_stream(1);
+        processor.set_data_callback([](uint32_t, std::span<const uint8_t> data, bool) {
+            benchmark::DoNotOptimize(data.data());
+        });
+        state.ResumeTiming();
+
+        auto result = processor.process_frames(std::span<const uint8_t>(wire));
+        benchmark::DoNotOptimize(result);
+        bytes += wire.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_Http2ProcessDataFrames);
+
+void BM_Http2GenerateDataFrame(benchmark::State& state) {
+    v2::frame_processor processor;
+    processor.get_stream_manager().create_stream(1);
+    std::string payload(static_cast<size_t>(state.range(0)), 'D');
+    std::span<const uint8_t> data(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+    output_buffer buffer(payload.size() + 64);
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        buffer.clear();
+        auto result = processor.generate_data_frame(1, data, false, buffer);
+        benchmark::DoNotOptimize(result);
+        bytes += buffer.size();
+        // 生成会扣减发送窗口，及时补回避免窗口耗尽
+        processor.get_stream_manager().update_stream_window(1, static_cast<int32_t>(payload.size()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_Http2GenerateDataFrame)->Arg(64)->Arg(1024)->Arg(16 * 1024 - 9);
+
+} // namespace
+
+BENCHMARK_MAIN();
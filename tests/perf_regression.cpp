@@ -0,0 +1,218 @@
+// 性能回归闸门：运行固定的、预热过的基准子集，与签入的基线JSON对比，
+// 超出噪声容忍度的回归直接以非零退出码失败（接入CTest）。
+//
+// 用法:
+//   perf_regression <baseline.json>              对比基线，回归则退出码1
+//   perf_regression --calibrate <baseline.json>  在当前机器上重新校准基线
+//
+// 噪声处理：每个场景先预热，再测量多轮取最佳值（最佳值对调度噪声最稳定），
+// 容忍度在基线文件中签入，默认容许40%波动——只拦截真回归，不拦抖动。
+
+#include "http_parse.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace co::http;
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// 场景
+// ---------------------------------------------------------------------------
+
+std::vector<std::string> MakeRequests(int count) {
+    std::vector<std::string> requests;
+    requests.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        std::ostringstream oss;
+        oss << "GET /api/resource/" << i << " HTTP/1.1\r\n"
+            << "Host: api.example.com\r\n"
+            << "User-Agent: PerfGate/1.0\r\n"
+            << "Accept: application/json\r\n"
+            << "X-Request-Id: req-" << i << "\r\n"
+            << "\r\n";
+        requests.push_back(oss.str());
+    }
+    return requests;
+}
+
+// 4线程并发解析（对应 BenchmarkTest.ConcurrentParsingBenchmark）
+double RunConcurrentParse() {
+    const int num_threads = 4;
+    const int iterations_per_thread = 25000;
+    auto requests = MakeRequests(100);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < iterations_per_thread; ++i) {
+                auto result = http1::parse_request(requests[(t + i) % requests.size()]);
+                if (!result) {
+                    std::abort();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return num_threads * iterations_per_thread / elapsed;
+}
+
+// 单线程响应编码（曾经发生过未被发现的30%回归的路径）
+double RunEncodeResponse() {
+    const int iterations = 200000;
+    response resp;
+    resp.status_code = 200;
+    resp.reason_phrase = "OK";
+    resp.add_header("content-type", "application/json");
+    resp.add_header("server", "PerfGate/1.0");
+    resp.body = R"({"status":"ok","items":[1,2,3,4,5]})";
+
+    output_buffer buffer;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        buffer.clear();
+        auto result = http1::encode_response(resp, buffer);
+        if (!result) {
+            std::abort();
+        }
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return iterations / elapsed;
+}
+
+// 缓冲区重用的编码循环（对应 BenchmarkTest.MemoryAllocationBenchmark）
+double RunBufferReuseEncode() {
+    const int iterations = 200000;
+    output_buffer reused_buffer;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        reused_buffer.clear();
+        request req;
+        req.method_type = method::get;
+        req.target = "/api/test/" + std::to_string(i % 1000);
+        req.protocol_version = version::http_1_1;
+        req.headers = {{"host", "api.example.com"}};
+        auto result = http1::encode_request(req, reused_buffer);
+        if (!result) {
+            std::abort();
+        }
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return iterations / elapsed;
+}
+
+struct scenario {
+    const char* name; // 基线JSON中的键
+    double (*run)();
+};
+
+constexpr scenario scenarios[] = {
+    {"concurrent_parse_ops_per_sec", RunConcurrentParse},
+    {"encode_response_ops_per_sec", RunEncodeResponse},
+    {"buffer_reuse_encode_ops_per_sec", RunBufferReuseEncode},
+};
+
+// 预热一轮后测量repeats轮，取最佳值
+double Measure(const scenario& s) {
+    const int repeats = 3;
+    s.run(); // 预热：填充缓存、触发频率爬升
+    double best = 0;
+    for (int i = 0; i < repeats; ++i) {
+        best = std::max(best, s.run());
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// 基线文件（扁平JSON，键为场景名，另有"tolerance"）
+// ---------------------------------------------------------------------------
+
+double ExtractNumber(const std::string& json, const std::string& key, double fallback) {
+    auto pos = json.find("\"" + key + "\"");
+    if (pos == std::string::npos) {
+        return fallback;
+    }
+    pos = json.find(':', pos);
+    if (pos == std::string::npos) {
+        return fallback;
+    }
+    return std::strtod(json.c_str() + pos + 1, nullptr);
+}
+
+void PinToCpu0() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(0, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set); // 尽力而为
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool calibrate = argc == 3 && std::string_view(argv[1]) == "--calibrate";
+    const char* baseline_path = calibrate ? argv[2] : (argc == 2 ? argv[1] : nullptr);
+    if (baseline_path == nullptr) {
+        std::fprintf(stderr, "usage: %s [--calibrate] <baseline.json>\n", argv[0]);
+        return 2;
+    }
+
+    PinToCpu0();
+
+    if (calibrate) {
+        std::ofstream out(baseline_path);
+        out << "{\n  \"tolerance\": 0.40";
+        for (const auto& s : scenarios) {
+            std::printf("calibrating %s ...\n", s.name);
+            out << ",\n  \"" << s.name << "\": " << static_cast<long long>(Measure(s));
+        }
+        out << "\n}\n";
+        std::printf("baseline written to %s\n", baseline_path);
+        return 0;
+    }
+
+    std::ifstream in(baseline_path);
+    if (!in) {
+        std::fprintf(stderr, "cannot open baseline: %s\n", baseline_path);
+        return 2;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string json = buffer.str();
+
+    double tolerance = ExtractNumber(json, "tolerance", 0.40);
+    int regressions = 0;
+
+    for (const auto& s : scenarios) {
+        double baseline = ExtractNumber(json, s.name, 0);
+        double measured = Measure(s);
+        double floor = baseline * (1.0 - tolerance);
+        bool ok = baseline <= 0 || measured >= floor;
+        std::printf("%-34s baseline %12.0f  measured %12.0f  floor %12.0f  %s\n",
+                    s.name, baseline, measured, floor, ok ? "ok" : "REGRESSION");
+        if (!ok) {
+            ++regressions;
+        }
+    }
+
+    if (regressions > 0) {
+        std::fprintf(stderr, "%d scenario(s) regressed beyond %.0f%% tolerance\n",
+                     regressions, tolerance * 100.0);
+        return 1;
+    }
+    return 0;
+}
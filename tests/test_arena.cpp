@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "http_parse.hpp"
+#include <string>
+
+using namespace co::http;
+
+class ArenaTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+// =============================================================================
+// message_arena 基础测试
+// =============================================================================
+
+TEST_F(ArenaTest, CopyReturnsStableView) {
+    message_arena arena;
+
+    std::string source = "hello arena";
+    auto view = arena.copy(source);
+
+    EXPECT_EQ(view, "hello arena");
+    EXPECT_NE(view.data(), source.data()); // 必须是arena内的副本
+
+    // 覆盖源缓冲区，arena副本保持不变
+    source.assign(source.size(), 'x');
+    EXPECT_EQ(view, "hello arena");
+}
+
+TEST_F(ArenaTest, ResetReclaimsStorage) {
+    message_arena arena(64);
+
+    arena.copy("some header value");
+    EXPECT_GT(arena.bytes_used(), 0);
+
+    arena.reset();
+    EXPECT_EQ(arena.bytes_used(), 0);
+}
+
+TEST_F(ArenaTest, GrowsBeyondBlockSize) {
+    message_arena arena(32);
+
+    // 多次分配，跨越多个块
+    std::string big(100, 'a');
+    auto v1 = arena.copy(big);
+    auto v2 = arena.copy("small");
+    auto v3 = arena.copy(big);
+
+    EXPECT_EQ(v1, big);
+    EXPECT_EQ(v2, "small");
+    EXPECT_EQ(v3, big);
+    EXPECT_EQ(arena.bytes_used(), 205);
+}
+
+// =============================================================================
+// arena支持的解析器测试
+// =============================================================================
+
+TEST_F(ArenaTest, ArenaBackedRequestViewSurvivesBufferReuse) {
+    message_arena arena;
+    parser p(version::http_1_1, arena);
+
+    std::string buffer =
+        "GET /api/users HTTP/1.1\r\n"
+        "Host: api.example.com\r\n"
+        "Content-Length: 5\r\n"
+        "\r\n"
+        "hello";
+
+    auto result = p.parse_request_view(buffer);
+    ASSERT_TRUE(result.has_value());
+    const auto& req = result.value();
+
+    // 覆盖输入缓冲区，模拟keep-alive连接上的缓冲区重用
+    std::fill(buffer.begin(), buffer.end(), 'x');
+
+    EXPECT_EQ(req.method_type, method::get);
+    auto host = req.get_header("host");
+    ASSERT_TRUE(host.has_value());
+    EXPECT_EQ(*host, "api.example.com");
+    EXPECT_EQ(req.body, "hello");
+}
+
+TEST_F(ArenaTest, ArenaResetBetweenKeepAliveRequests) {
+    message_arena arena;
+    parser p(version::http_1_1, arena);
+
+    std::string request_data =
+        "GET / HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "\r\n";
+
+    for (int i = 0; i < 3; ++i) {
+        auto result = p.parse_request_view(request_data);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->headers.size(), 1);
+
+        arena.reset();
+        EXPECT_EQ(arena.bytes_used(), 0);
+    }
+}
+
+// =============================================================================
+// Header名称驻留测试
+// =============================================================================
+
+TEST_F(ArenaTest, InternedHeaderNamesStableAcrossArenaReset) {
+    message_arena arena;
+    parser p(version::http_1_1, arena);
+
+    std::string request_data =
+        "GET / HTTP/1.1\r\n"
+        "host: example.com\r\n"
+        "X-Custom-Trace: abc\r\n"
+        "\r\n";
+
+    // 第一轮解析后记录各header名称的存储地址
+    auto first = p.parse_request_view(request_data);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ(first->headers.size(), 2);
+    const char* host_atom = first->headers[0].name.data();
+    const char* custom_atom = first->headers[1].name.data();
+
+    // 已知名称直接命中静态词表，无需任何拷贝
+    EXPECT_EQ(first->headers[0].name, "host");
+
+    arena.reset();
+
+    // 第二轮解析：名称去重到同一原子，地址不变（arena拷贝则必然变化）
+    auto second = p.parse_request_view(request_data);
+    ASSERT_TRUE(second.has_value());
+    ASSERT_EQ(second->headers.size(), 2);
+    EXPECT_EQ(second->headers[0].name.data(), host_atom);
+    EXPECT_EQ(second->headers[1].name.data(), custom_atom);
+    EXPECT_EQ(second->headers[1].name, "X-Custom-Trace");
+}
+
+TEST_F(ArenaTest, InternerDedupsDirectly) {
+    auto& interner = detail::header_name_interner::local();
+    size_t before = interner.size();
+
+    // 静态词表命中不占用动态原子
+    auto a = interner.intern(":method");
+    auto b = interner.intern("content-length");
+    EXPECT_EQ(a, ":method");
+    EXPECT_EQ(b, "content-length");
+    EXPECT_EQ(interner.size(), before);
+
+    // 未知名称只拷贝一次，再次驻留得到同一视图
+    std::string scratch = "x-intern-test-name";
+    auto first = interner.intern(scratch);
+    scratch[0] = 'X'; // 修改源字符串不影响原子
+    auto again = interner.intern("x-intern-test-name");
+    EXPECT_EQ(first.data(), again.data());
+    EXPECT_EQ(interner.size(), before + 1);
+}
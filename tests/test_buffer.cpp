@@ -272,4 +272,89 @@ TEST_F(BufferTest, OutputBufferStringConversion) {
     // 获取string_view
     auto view = buffer.string_view();
     EXPECT_EQ(view, test_data);
-}
\ No newline at end of file
+}
+// =============================================================================
+// 分段缓冲区测试
+// =============================================================================
+
+TEST_F(BufferTest, SegmentedBufferAppendAndFlatten) {
+    segmented_buffer buffer;
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.append(std::string_view("hello "));
+    buffer.append("world", 5);
+    buffer.append_byte('!');
+
+    EXPECT_EQ(buffer.size(), 12);
+    EXPECT_EQ(buffer.to_string(), "hello world!");
+
+    // 单块数据导出为单个 iovec
+    auto iovs = buffer.as_iovecs();
+    ASSERT_EQ(iovs.size(), 1);
+    EXPECT_EQ(iovs[0].iov_len, 12);
+}
+
+TEST_F(BufferTest, SegmentedBufferStableSpansAcrossGrowth) {
+    segmented_buffer buffer;
+    buffer.append(std::string_view("stable prefix"));
+    auto iovs = buffer.as_iovecs();
+    const void* first_block = iovs[0].iov_base;
+
+    // 追加远超一个块的数据，先前的字节不得移动
+    std::string big(segmented_buffer::block_size * 3, 'x');
+    buffer.append(big);
+
+    iovs = buffer.as_iovecs();
+    ASSERT_GE(iovs.size(), 4);
+    EXPECT_EQ(iovs[0].iov_base, first_block);
+    EXPECT_EQ(buffer.size(), 13 + big.size());
+
+    // 展平后内容保持线序
+    std::string flat = buffer.to_string();
+    EXPECT_EQ(flat.substr(0, 13), "stable prefix");
+    EXPECT_EQ(flat.size(), 13 + big.size());
+}
+
+TEST_F(BufferTest, SegmentedBufferResetRecyclesBlocks) {
+    segmented_buffer buffer;
+    std::string data(segmented_buffer::block_size + 100, 'y');
+    buffer.append(data);
+    auto iovs = buffer.as_iovecs();
+    ASSERT_EQ(iovs.size(), 2);
+    const void* recycled_block = iovs[1].iov_base; // 冻结列表后进先出
+
+    buffer.reset();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.as_iovecs().empty());
+
+    // 新一轮写入应复用冻结列表中的块，而非重新分配
+    buffer.append(std::string_view("recycled"));
+    iovs = buffer.as_iovecs();
+    ASSERT_EQ(iovs.size(), 1);
+    EXPECT_EQ(iovs[0].iov_base, recycled_block);
+    EXPECT_EQ(buffer.to_string(), "recycled");
+}
+
+// =============================================================================
+// 缓冲区统计计数器测试
+// =============================================================================
+
+TEST_F(BufferTest, OutputBufferStatsCountRegrows) {
+    output_buffer buffer(64);
+
+    // 预留范围内的追加不应触发扩容
+    buffer.append("small");
+    EXPECT_EQ(buffer.get_stats().appends, 1);
+    EXPECT_EQ(buffer.get_stats().bytes_appended, 5);
+    EXPECT_EQ(buffer.get_stats().regrows, 0);
+
+    // 超出容量的追加记录一次扩容
+    std::string big(4096, 'x');
+    buffer.append(big);
+    EXPECT_GE(buffer.get_stats().regrows, 1);
+    EXPECT_EQ(buffer.get_stats().bytes_appended, 5 + big.size());
+
+    buffer.reset_stats();
+    EXPECT_EQ(buffer.get_stats().appends, 0);
+    EXPECT_EQ(buffer.get_stats().regrows, 0);
+}
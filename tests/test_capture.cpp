@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "http_parse/capture.hpp"
+#include <string>
+#include <vector>
+
+using namespace co::http;
+
+class CaptureTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+TEST_F(CaptureTest, WriterReaderRoundTrip) {
+    capture_writer writer;
+    writer.add_record("GET / HTTP/1.1\r\n");
+    writer.add_record("Host: example.com\r\n\r\n");
+    writer.add_record(std::string_view{}); // 空读也是合法记录
+    EXPECT_EQ(writer.record_count(), 3);
+
+    capture_reader reader(writer.data());
+    ASSERT_TRUE(reader.valid());
+
+    auto first = reader.next();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(std::string(first->begin(), first->end()), "GET / HTTP/1.1\r\n");
+
+    auto second = reader.next();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->size(), 21);
+
+    auto third = reader.next();
+    ASSERT_TRUE(third.has_value());
+    EXPECT_TRUE(third->empty());
+
+    EXPECT_FALSE(reader.next().has_value()); // 捕获结束
+    EXPECT_TRUE(reader.valid());
+
+    // reset后可重新遍历
+    reader.reset();
+    EXPECT_TRUE(reader.next().has_value());
+}
+
+TEST_F(CaptureTest, RecordsAreReadInPlace) {
+    capture_writer writer;
+    writer.add_record("payload");
+
+    auto capture = writer.data();
+    capture_reader reader(capture);
+    auto record = reader.next();
+    ASSERT_TRUE(record.has_value());
+
+    // 返回的切片直接指向捕获存储（mmap场景下即文件页），无拷贝
+    EXPECT_GE(record->data(), capture.data());
+    EXPECT_LT(record->data(), capture.data() + capture.size());
+}
+
+TEST_F(CaptureTest, RejectsBadMagicAndTruncatedRecords) {
+    std::vector<uint8_t> garbage = {'N', 'O', 'P', 'E', 0, 0, 0, 0, 1, 2, 3};
+    capture_reader bad(garbage);
+    EXPECT_FALSE(bad.valid());
+    EXPECT_FALSE(bad.next().has_value());
+
+    // 记录声明长度超过剩余字节：视为截断
+    capture_writer writer;
+    writer.add_record("0123456789");
+    std::vector<uint8_t> truncated(writer.data().begin(), writer.data().end() - 4);
+    capture_reader reader(truncated);
+    ASSERT_TRUE(reader.valid());
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_FALSE(reader.valid());
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "http_parse.hpp"
+#include <coroutine>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace co::http;
+
+namespace {
+
+// 总是就绪的读取器：从预先切好的输入块中逐块产出，
+// 空span表示输入结束
+struct chunked_reader {
+    std::vector<std::string> chunks;
+    size_t next = 0;
+
+    bool await_ready() const noexcept { return true; }
+    void await_suspend(std::coroutine_handle<>) const noexcept {}
+    std::span<const char> await_resume() {
+        if (next >= chunks.size()) {
+            return {};
+        }
+        const auto& chunk = chunks[next++];
+        return {chunk.data(), chunk.size()};
+    }
+};
+
+// 外层协程：验证parse_task可以被co_await组合
+parse_task<bool> parse_via_outer_coroutine(parser& p, chunked_reader& reader, request& out) {
+    auto result = co_await p.async_parse_request(reader);
+    if (!result) {
+        co_return false;
+    }
+    out = std::move(*result);
+    co_return true;
+}
+
+} // namespace
+
+class CoroParserTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+TEST_F(CoroParserTest, AsyncParseRequestAcrossChunks) {
+    parser p(version::http_1_1);
+    chunked_reader reader{{
+        "GET /api/test HT",
+        "TP/1.1\r\nHost: api.example.com\r\n",
+        "Content-Length: 11\r\n\r\nhello",
+        " world"
+    }};
+
+    auto task = p.async_parse_request(reader);
+    EXPECT_FALSE(task.done()); // 惰性：恢复前不做任何事
+    task.resume();
+    ASSERT_TRUE(task.done());
+
+    auto result = task.result();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->method_type, method::get);
+    EXPECT_EQ(result->target, "/api/test");
+    EXPECT_EQ(result->body, "hello world");
+}
+
+TEST_F(CoroParserTest, AsyncParseResponseAcrossChunks) {
+    parser p(version::http_1_1);
+    chunked_reader reader{{
+        "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n",
+        "\r\nok"
+    }};
+
+    auto task = p.async_parse_response(reader);
+    task.resume();
+    ASSERT_TRUE(task.done());
+
+    auto result = task.result();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->status_code, 200);
+    EXPECT_EQ(result->body, "ok");
+}
+
+TEST_F(CoroParserTest, AsyncParseReportsTruncatedInput) {
+    parser p(version::http_1_1);
+    chunked_reader reader{{"GET / HTTP/1.1\r\nHost: exa"}};
+
+    auto task = p.async_parse_request(reader);
+    task.resume();
+    ASSERT_TRUE(task.done());
+
+    auto result = task.result();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), error_code::need_more_data);
+}
+
+TEST_F(CoroParserTest, TaskComposesWithOuterCoroutine) {
+    parser p(version::http_1_1);
+    chunked_reader reader{{"POST /submit HTTP/1.1\r\n", "Content-Length: 4\r\n\r\ndata"}};
+
+    request req;
+    auto task = parse_via_outer_coroutine(p, reader, req);
+    task.resume();
+    ASSERT_TRUE(task.done());
+    EXPECT_TRUE(task.result());
+    EXPECT_EQ(req.method_type, method::post);
+    EXPECT_EQ(req.body, "data");
+}
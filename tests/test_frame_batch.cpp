@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "http_parse.hpp"
+#include "http_parse/v2/frame_batch.hpp"
+#include <string>
+#include <vector>
+
+using namespace co::http::v2;
+
+class FrameBatchTest : public ::testing::Test {
+protected:
+    // 辅助函数：把 iovec 列表展平成连续字节流（模拟 writev 的线序）
+    std::vector<uint8_t> Flatten(const frame_batch& batch) {
+        std::vector<uint8_t> wire;
+        for (const auto& iov : batch.iovecs()) {
+            const uint8_t* base = static_cast<const uint8_t*>(iov.iov_base);
+            wire.insert(wire.end(), base, base + iov.iov_len);
+        }
+        return wire;
+    }
+
+    frame_batch batch;
+};
+
+// =============================================================================
+// 帧批量编码测试
+// =============================================================================
+
+TEST_F(FrameBatchTest, DataFramePayloadIsReferencedNotCopied) {
+    std::string body = "response body bytes";
+    std::span<const uint8_t> payload(reinterpret_cast<const uint8_t*>(body.data()),
+                                     body.size());
+
+    batch.add_data_frame(1, payload, true);
+
+    ASSERT_EQ(batch.frame_count(), 1);
+    EXPECT_EQ(batch.total_bytes(), 9 + body.size());
+
+    // 载荷 iovec 必须直接指向调用方的存储
+    auto iovs = batch.iovecs();
+    ASSERT_EQ(iovs.size(), 2);
+    EXPECT_EQ(iovs[1].iov_base, static_cast<const void*>(body.data()));
+    EXPECT_EQ(iovs[1].iov_len, body.size());
+}
+
+TEST_F(FrameBatchTest, FlightRoundTripsThroughFrameProcessor) {
+    // HEADERS + DATA + WINDOW_UPDATE 的一个完整航程
+    frame_processor processor;
+    co::http::output_buffer header_block;
+    std::vector<co::http::header> headers = {
+        {":status", "200"}, {"content-type", "text/plain"}
+    };
+    ASSERT_TRUE(processor.get_hpack_encoder().encode_headers(headers, header_block).has_value());
+
+    std::string body = "hello";
+    std::span<const uint8_t> payload(reinterpret_cast<const uint8_t*>(body.data()),
+                                     body.size());
+
+    batch.add_headers_frame(1, header_block.span(), false, true);
+    batch.add_data_frame(1, payload, true);
+    batch.add_window_update_frame(1, 65535);
+    EXPECT_EQ(batch.frame_count(), 3);
+
+    // 展平后的字节流必须能被帧处理器完整消费
+    auto wire = Flatten(batch);
+    EXPECT_EQ(wire.size(), batch.total_bytes());
+
+    size_t data_frames = 0;
+    std::string received_body;
+    processor.set_data_callback([&](uint32_t, std::span<const uint8_t> data, bool) {
+        ++data_frames;
+        received_body.append(reinterpret_cast<const char*>(data.data()), data.size());
+    });
+    ASSERT_TRUE(processor.get_stream_manager().create_stream(1).has_value());
+
+    auto result = processor.process_frames(std::span<const uint8_t>(wire));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), wire.size());
+    EXPECT_EQ(data_frames, 1);
+    EXPECT_EQ(received_body, body);
+}
+
+TEST_F(FrameBatchTest, AdjacentControlFramesCoalesce) {
+    // 连续的竞技场段应合并成单个 iovec 条目
+    batch.add_settings_ack();
+    batch.add_window_update_frame(0, 1024);
+    batch.add_rst_stream_frame(3, h2_error_code::cancel);
+
+    EXPECT_EQ(batch.frame_count(), 3);
+    EXPECT_EQ(batch.iovecs().size(), 1);
+    EXPECT_EQ(batch.total_bytes(), 9 + (9 + 4) + (9 + 4));
+}
+
+TEST_F(FrameBatchTest, ClearRecyclesForNextFlight) {
+    std::vector<uint8_t> payload = {'x', 'y', 'z'};
+    batch.add_data_frame(1, payload, false);
+    batch.clear();
+
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.total_bytes(), 0);
+    EXPECT_TRUE(batch.iovecs().empty());
+
+    batch.add_ping_frame(std::span<const uint8_t, 8>(
+                             std::array<uint8_t, 8>{1, 2, 3, 4, 5, 6, 7, 8}),
+                         false);
+    EXPECT_EQ(batch.frame_count(), 1);
+    EXPECT_EQ(batch.total_bytes(), 9 + 8);
+}
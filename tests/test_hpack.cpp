@@ -473,4 +473,252 @@ TEST_F(HpackTest, IntegerEncoding) {
 TEST_F(HpackTest, IntegerBoundaryValues) {
     // Low-level integer encoding API not exposed - test disabled
     EXPECT_TRUE(true); // Placeholder
-}
\ No newline at end of file
+}
+// =============================================================================
+// 动态表哈希索引测试
+// =============================================================================
+
+TEST_F(HpackTest, RepeatedHeadersUseDynamicIndex) {
+    std::vector<co::http::header> headers = {
+        {"x-custom-header", "custom-value"},
+        {"x-request-id", "abc-123"}
+    };
+
+    co::http::output_buffer first;
+    auto first_result = encoder->encode_headers(headers, first);
+    ASSERT_TRUE(first_result.has_value());
+
+    // 第二次编码应命中动态表索引，输出显著更小
+    co::http::output_buffer second;
+    auto second_result = encoder->encode_headers(headers, second);
+    ASSERT_TRUE(second_result.has_value());
+    EXPECT_LT(second.size(), first.size());
+
+    // 两个头部块都必须解码为相同的头部
+    auto block1 = decoder->decode_headers(first.span());
+    ASSERT_TRUE(block1.has_value());
+    auto block2 = decoder->decode_headers(second.span());
+    ASSERT_TRUE(block2.has_value());
+
+    ASSERT_EQ(block2->size(), 2);
+    VerifyHeader((*block2)[0], "x-custom-header", "custom-value");
+    VerifyHeader((*block2)[1], "x-request-id", "abc-123");
+}
+
+TEST_F(HpackTest, DynamicIndexSurvivesEviction) {
+    encoder->set_dynamic_table_size(128);
+    decoder->set_dynamic_table_size(128);
+
+    // 插入远超动态表容量的条目，强制持续淘汰
+    for (int i = 0; i < 50; ++i) {
+        std::vector<co::http::header> headers = {
+            {"x-header-" + std::to_string(i), "value-" + std::to_string(i)}
+        };
+        co::http::output_buffer out;
+        auto encoded = encoder->encode_headers(headers, out);
+        ASSERT_TRUE(encoded.has_value());
+
+        auto decoded = decoder->decode_headers(out.span());
+        ASSERT_TRUE(decoded.has_value());
+        ASSERT_EQ(decoded->size(), 1);
+        VerifyHeader((*decoded)[0], "x-header-" + std::to_string(i),
+                     "value-" + std::to_string(i));
+    }
+}
+
+TEST_F(HpackTest, HuffmanRoundTripCompressesText) {
+    // 典型可压缩文本：Huffman 编码应小于原始长度且可无损还原
+    std::vector<co::http::header> headers = {
+        {"user-agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36"}
+    };
+
+    co::http::output_buffer out;
+    auto encoded = encoder->encode_headers(headers, out);
+    ASSERT_TRUE(encoded.has_value());
+    EXPECT_LT(out.size(), 11 + 50);
+
+    auto decoded = decoder->decode_headers(out.span());
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), 1);
+    VerifyHeader((*decoded)[0], "user-agent",
+                 "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36");
+}
+
+TEST_F(HpackTest, HuffmanRoundTripBinaryValue) {
+    // 不可压缩数据必须自动回退到原始编码，往返仍需一致
+    std::string value;
+    for (int i = 0; i < 256; ++i) {
+        value.push_back(static_cast<char>(i));
+    }
+    std::vector<co::http::header> headers = {{"x-binary", value}};
+
+    co::http::output_buffer out;
+    auto encoded = encoder->encode_headers(headers, out);
+    ASSERT_TRUE(encoded.has_value());
+
+    auto decoded = decoder->decode_headers(out.span());
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), 1);
+    VerifyHeader((*decoded)[0], "x-binary", value);
+}
+
+TEST_F(HpackTest, HuffmanDecodeRejectsBadPadding) {
+    // Huffman 标志 + 全零填充字节不是合法的 EOS 前缀，必须报压缩错误
+    std::vector<uint8_t> block = {0x40, 0x03, 'f', 'o', 'o', 0x81, 0x00};
+    auto decoded = decoder->decode_headers(block);
+    EXPECT_FALSE(decoded.has_value());
+    EXPECT_EQ(decoded.error(), co::http::error_code::compression_error);
+}
+
+TEST_F(HpackTest, ResizePreservesSurvivingEntries) {
+    // 表缩小后幸存条目需重新压实到新存储，索引语义保持不变
+    std::vector<co::http::header> headers = {
+        {"x-alpha", "one"}, {"x-beta", "two"}, {"x-gamma", "three"}
+    };
+    co::http::output_buffer first;
+    ASSERT_TRUE(encoder->encode_headers(headers, first).has_value());
+    ASSERT_TRUE(decoder->decode_headers(first.span()).has_value());
+
+    // 收缩到只容纳最近两个条目（每条 32 + name + value 字节）
+    encoder->set_dynamic_table_size(100);
+    decoder->set_dynamic_table_size(100);
+
+    co::http::output_buffer second;
+    ASSERT_TRUE(encoder->encode_headers(headers, second).has_value());
+    auto decoded = decoder->decode_headers(second.span());
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), 3);
+    VerifyHeader((*decoded)[0], "x-alpha", "one");
+    VerifyHeader((*decoded)[1], "x-beta", "two");
+    VerifyHeader((*decoded)[2], "x-gamma", "three");
+}
+
+TEST_F(HpackTest, StatsTrackTableHitsAndHuffman) {
+    std::vector<co::http::header> headers = {
+        {":method", "GET"},                       // 静态表完全命中
+        {"x-custom-metric", "aaaaaaaaaaaaaaaa"}   // 字面量，可被 Huffman 压缩
+    };
+
+    co::http::output_buffer first;
+    ASSERT_TRUE(encoder->encode_headers(headers, first).has_value());
+    const auto& enc = encoder->get_stats();
+    EXPECT_EQ(enc.headers_encoded, 2);
+    EXPECT_EQ(enc.static_hits, 1);
+    EXPECT_EQ(enc.dynamic_hits, 0);
+    EXPECT_EQ(enc.literal_headers, 1);
+    EXPECT_GT(enc.huffman_bytes_in, 0);
+    EXPECT_LT(enc.huffman_bytes_out, enc.huffman_bytes_in);
+
+    // 第二轮编码时自定义头已进入动态表
+    co::http::output_buffer second;
+    ASSERT_TRUE(encoder->encode_headers(headers, second).has_value());
+    EXPECT_EQ(encoder->get_stats().dynamic_hits, 1);
+
+    auto decoded = decoder->decode_headers(first.span());
+    ASSERT_TRUE(decoded.has_value());
+    const auto& dec = decoder->get_stats();
+    EXPECT_EQ(dec.headers_decoded, 2);
+    EXPECT_EQ(dec.static_hits, 1);
+    EXPECT_EQ(dec.literal_headers, 1);
+    EXPECT_GT(dec.huffman_bytes_out, dec.huffman_bytes_in);
+
+    encoder->reset_stats();
+    EXPECT_EQ(encoder->get_stats().headers_encoded, 0);
+}
+
+TEST_F(HpackTest, ThroughputPolicySkipsDynamicTableAndHuffman) {
+    encoder->set_indexing_policy(hpack_encoder::indexing_policy::throughput);
+
+    std::vector<co::http::header> headers = {
+        {":method", "GET"},                        // 静态表命中仍然免费
+        {"x-custom-metric", "aaaaaaaaaaaaaaaa"},   // 可压缩字面量
+        {"x-request-id", "abc-123"}
+    };
+
+    co::http::output_buffer first;
+    ASSERT_TRUE(encoder->encode_headers(headers, first).has_value());
+    co::http::output_buffer second;
+    ASSERT_TRUE(encoder->encode_headers(headers, second).has_value());
+
+    // 不维护动态表：重复编码也没有动态命中，输出大小不变
+    const auto& stats = encoder->get_stats();
+    EXPECT_EQ(stats.static_hits, 2);
+    EXPECT_EQ(stats.dynamic_hits, 0);
+    EXPECT_EQ(second.size(), first.size());
+    // 不做Huffman编码
+    EXPECT_EQ(stats.huffman_bytes_in, 0);
+
+    // 输出仍是合法HPACK，解码端无需任何配置
+    auto decoded = decoder->decode_headers(second.span());
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), 3);
+    VerifyHeader((*decoded)[1], "x-custom-metric", "aaaaaaaaaaaaaaaa");
+    // 解码端动态表同样保持为空
+    EXPECT_EQ(decoder->get_stats().dynamic_hits, 0);
+}
+
+TEST_F(HpackTest, RatioPolicyBeatsThroughputOnRepeatedHeaders) {
+    std::vector<co::http::header> headers = {
+        {"x-custom-header", "custom-value"},
+        {"x-request-id", "abc-123"}
+    };
+
+    hpack_encoder throughput_encoder;
+    throughput_encoder.set_indexing_policy(hpack_encoder::indexing_policy::throughput);
+    hpack_encoder ratio_encoder;  // ratio为默认策略
+    EXPECT_EQ(ratio_encoder.get_indexing_policy(), hpack_encoder::indexing_policy::ratio);
+
+    co::http::output_buffer throughput_warm;
+    co::http::output_buffer ratio_warm;
+    for (int i = 0; i < 2; ++i) {
+        throughput_warm.clear();
+        ratio_warm.clear();
+        ASSERT_TRUE(throughput_encoder.encode_headers(headers, throughput_warm).has_value());
+        ASSERT_TRUE(ratio_encoder.encode_headers(headers, ratio_warm).has_value());
+    }
+
+    // 预热后ratio模式命中动态表，输出远小于纯字面量
+    EXPECT_LT(ratio_warm.size(), throughput_warm.size());
+}
+
+TEST_F(HpackTest, AdaptivePolicySwitchesOnColdTraffic) {
+    encoder->set_indexing_policy(hpack_encoder::indexing_policy::adaptive);
+    EXPECT_EQ(encoder->effective_policy(), hpack_encoder::indexing_policy::ratio);
+
+    // 全唯一头部：动态表零命中，一个采样窗口后退化为字面量模式
+    int serial = 0;
+    auto encode_unique_window = [&](int count) {
+        for (int i = 0; i < count; ++i) {
+            std::vector<co::http::header> headers = {
+                {"x-unique-" + std::to_string(serial), "v" + std::to_string(serial)}
+            };
+            ++serial;
+            co::http::output_buffer out;
+            ASSERT_TRUE(encoder->encode_headers(headers, out).has_value());
+            auto decoded = decoder->decode_headers(out.span());
+            ASSERT_TRUE(decoded.has_value());
+        }
+    };
+
+    encode_unique_window(256);
+    EXPECT_EQ(encoder->effective_policy(), hpack_encoder::indexing_policy::throughput);
+
+    // 字面量模式下继续送入重复头部；探测窗口重新打开索引后，
+    // 高命中率使编码器切回ratio模式
+    std::vector<co::http::header> repeated = {
+        {"x-hot-header", "hot-value"}
+    };
+    for (int i = 0; i < 256 * 8; ++i) {
+        co::http::output_buffer out;
+        ASSERT_TRUE(encoder->encode_headers(repeated, out).has_value());
+        auto decoded = decoder->decode_headers(out.span());
+        ASSERT_TRUE(decoded.has_value());
+        ASSERT_EQ(decoded->size(), 1);
+        VerifyHeader((*decoded)[0], "x-hot-header", "hot-value");
+    }
+    EXPECT_EQ(encoder->effective_policy(), hpack_encoder::indexing_policy::ratio);
+
+    // set_indexing_policy重置自适应状态
+    encoder->set_indexing_policy(hpack_encoder::indexing_policy::adaptive);
+    EXPECT_EQ(encoder->effective_policy(), hpack_encoder::indexing_policy::ratio);
+}
@@ -482,4 +482,71 @@ TEST_F(Http1BuilderTest, BuilderCopy) {
       found = true;
   }
   EXPECT_TRUE(found);
-}
\ No newline at end of file
+}
+// =============================================================================
+// 直接构建到缓冲区测试
+// =============================================================================
+
+TEST_F(Http1BuilderTest, BuildRequestIntoBuffer) {
+  output_buffer output;
+  auto written = http1::request_builder()
+                     .method(method::post)
+                     .uri("/api/users")
+                     .header("host", "api.example.com")
+                     .body(R"({"name":"test"})")
+                     .build_into(output);
+  ASSERT_TRUE(written.has_value());
+  EXPECT_EQ(written.value(), output.size());
+
+  std::string expected =
+      "POST /api/users HTTP/1.1\r\n"
+      "host: api.example.com\r\n"
+      "Content-Length: 15\r\n"
+      "\r\n"
+      R"({"name":"test"})";
+  EXPECT_EQ(output.view(), expected);
+}
+
+TEST_F(Http1BuilderTest, BuildResponseIntoBuffer) {
+  output_buffer output;
+  auto written = http1::response_builder()
+                     .status(404)
+                     .content_type("text/plain")
+                     .header("date", "Thu, 01 Jan 2026 00:00:00 GMT")
+                     .body("missing")
+                     .build_into(output);
+  ASSERT_TRUE(written.has_value());
+  EXPECT_EQ(written.value(), output.size());
+
+  std::string expected =
+      "HTTP/1.1 404 Not Found\r\n"
+      "content-type: text/plain\r\n"
+      "date: Thu, 01 Jan 2026 00:00:00 GMT\r\n"
+      "Content-Length: 7\r\n"
+      "\r\n"
+      "missing";
+  EXPECT_EQ(output.view(), expected);
+}
+
+TEST_F(Http1BuilderTest, BuildResponseIntoBufferStampsDate) {
+  output_buffer output;
+  ASSERT_TRUE(http1::response_builder().ok().build_into(output).has_value());
+
+  auto parsed = http1::parse_response(output.view());
+  ASSERT_TRUE(parsed.has_value());
+  auto date = parsed->get_header("date");
+  ASSERT_TRUE(date.has_value());
+  EXPECT_EQ(date->size(), 29);
+}
+
+TEST_F(Http1BuilderTest, RvalueBuildMovesBody) {
+  std::string big_body(1024 * 1024, 'x');
+  auto builder = http1::request_builder()
+                     .method(method::post)
+                     .uri("/api/large")
+                     .body(big_body);
+  auto req = std::move(builder).build();
+  EXPECT_EQ(req.body.size(), big_body.size());
+  // build() && 移动内部对象，构建器中的body随之转移
+  EXPECT_TRUE(builder.build().body.empty());
+}
@@ -43,7 +43,11 @@ protected:
         EXPECT_EQ(parsed_resp.status_code, original_resp.status_code);
         EXPECT_EQ(parsed_resp.protocol_version, original_resp.protocol_version);
         EXPECT_EQ(parsed_resp.body, original_resp.body);
-        EXPECT_EQ(parsed_resp.headers.size(), original_resp.headers.size());
+        // 缺少Date时编码器自动补一条（RFC 7231）
+        size_t expected_headers = original_resp.headers.size() +
+                                  (original_resp.has_header("date") ? 0 : 1);
+        EXPECT_EQ(parsed_resp.headers.size(), expected_headers);
+        EXPECT_TRUE(parsed_resp.has_header("date"));
     }
 };
 
@@ -160,16 +164,19 @@ TEST_F(Http1EncoderTest, EncodeSimpleResponse) {
     resp.add_header("content-type", "application/json");
     resp.add_header("server", "TestServer/1.0");
     resp.add_header("content-length", "17");
+    // 显式Date避免与自动补全的时间戳比较产生抖动
+    resp.add_header("date", "Thu, 01 Jan 2026 00:00:00 GMT");
     resp.body = R"({"status": "ok"})";
-    
+
     auto result = http1::encode_response(resp);
     ASSERT_TRUE(result.has_value());
-    
-    std::string expected = 
+
+    std::string expected =
         "HTTP/1.1 200 OK\r\n"
         "content-type: application/json\r\n"
         "server: TestServer/1.0\r\n"
         "content-length: 17\r\n"
+        "date: Thu, 01 Jan 2026 00:00:00 GMT\r\n"
         "\r\n"
         R"({"status": "ok"})";
     
@@ -282,4 +289,190 @@ TEST_F(Http1EncoderTest, EncodeRequestWithSpecialCharacters) {
     // 验证特殊字符被正确编码
     EXPECT_TRUE(result.value().find(req.target) != std::string::npos);
     EXPECT_TRUE(result.value().find(req.body) != std::string::npos);
-}
\ No newline at end of file
+}
+// =============================================================================
+// 预序列化响应模板测试
+// =============================================================================
+
+TEST_F(Http1EncoderTest, ResponseTemplateStampsBodyAndContentLength) {
+    response skeleton;
+    skeleton.protocol_version = version::http_1_1;
+    skeleton.status_code = 200;
+    skeleton.reason_phrase = "OK";
+    skeleton.add_header("server", "TestServer/1.0");
+    skeleton.add_header("content-type", "application/json");
+    // 显式Date：模板不保留槽位，输出可以逐字节比较
+    skeleton.add_header("date", "Thu, 01 Jan 2026 00:00:00 GMT");
+
+    response_template tmpl(skeleton);
+    EXPECT_FALSE(tmpl.has_date_slot());
+    encoder enc(version::http_1_1);
+
+    output_buffer output;
+    auto result = enc.encode_from_template(tmpl, R"({"ok":true})", output);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), output.size());
+
+    std::string expected =
+        "HTTP/1.1 200 OK\r\n"
+        "server: TestServer/1.0\r\n"
+        "content-type: application/json\r\n"
+        "date: Thu, 01 Jan 2026 00:00:00 GMT\r\n"
+        "Content-Length: 11\r\n"
+        "\r\n"
+        R"({"ok":true})";
+    EXPECT_EQ(output.view(), expected);
+}
+
+TEST_F(Http1EncoderTest, ResponseTemplateReusedAcrossBodies) {
+    response skeleton;
+    skeleton.status_code = 404;
+    skeleton.reason_phrase = "Not Found";
+    skeleton.add_header("content-type", "text/plain");
+    // 骨架上的Content-Length会被丢弃，编码时按实际body长度填充
+    skeleton.add_header("content-length", "999");
+
+    response_template tmpl(skeleton);
+    encoder enc(version::http_1_1);
+
+    for (std::string_view body : {"missing", "", "a longer not-found explanation"}) {
+        output_buffer output;
+        ASSERT_TRUE(enc.encode_from_template(tmpl, body, output).has_value());
+
+        auto parsed = http1::parse_response(output.view());
+        ASSERT_TRUE(parsed.has_value());
+        EXPECT_EQ(parsed->status_code, 404);
+        EXPECT_EQ(parsed->body, body);
+        auto content_length = parsed->get_header("content-length");
+        ASSERT_TRUE(content_length.has_value());
+        EXPECT_EQ(*content_length, std::to_string(body.size()));
+    }
+}
+
+// =============================================================================
+// Date header缓存测试
+// =============================================================================
+
+TEST_F(Http1EncoderTest, CachedDateIsWellFormedImfFixdate) {
+    auto date = encoder::cached_date();
+    ASSERT_EQ(date.size(), 29); // "Sun, 06 Nov 1994 08:49:37 GMT"
+    EXPECT_EQ(date.substr(3, 2), ", ");
+    EXPECT_EQ(date[19], ':');
+    EXPECT_EQ(date[22], ':');
+    EXPECT_EQ(date.substr(25), " GMT");
+
+    // 同一秒内重复调用返回同一缓存，不重新格式化
+    EXPECT_EQ(encoder::cached_date().data(), date.data());
+}
+
+TEST_F(Http1EncoderTest, EncodeResponseStampsDateWhenMissing) {
+    response resp;
+    resp.status_code = 204;
+    resp.reason_phrase = "No Content";
+
+    auto encoded = http1::encode_response(resp);
+    ASSERT_TRUE(encoded.has_value());
+
+    auto parsed = http1::parse_response(encoded.value());
+    ASSERT_TRUE(parsed.has_value());
+    auto date = parsed->get_header("date");
+    ASSERT_TRUE(date.has_value());
+    EXPECT_EQ(date->size(), 29);
+
+    // 显式提供的Date原样保留，不重复补写
+    response with_date;
+    with_date.status_code = 200;
+    with_date.reason_phrase = "OK";
+    with_date.add_header("date", "Thu, 01 Jan 2026 00:00:00 GMT");
+    auto encoded2 = http1::encode_response(with_date);
+    ASSERT_TRUE(encoded2.has_value());
+    auto parsed2 = http1::parse_response(encoded2.value());
+    ASSERT_TRUE(parsed2.has_value());
+    EXPECT_EQ(parsed2->headers.size(), 1);
+    EXPECT_EQ(*parsed2->get_header("date"), "Thu, 01 Jan 2026 00:00:00 GMT");
+}
+
+TEST_F(Http1EncoderTest, ResponseTemplateFillsDateSlot) {
+    response skeleton;
+    skeleton.status_code = 200;
+    skeleton.reason_phrase = "OK";
+    skeleton.add_header("content-type", "text/plain");
+
+    response_template tmpl(skeleton);
+    EXPECT_TRUE(tmpl.has_date_slot());
+    encoder enc(version::http_1_1);
+
+    output_buffer output;
+    ASSERT_TRUE(enc.encode_from_template(tmpl, "pong", output).has_value());
+
+    auto parsed = http1::parse_response(output.view());
+    ASSERT_TRUE(parsed.has_value());
+    auto date = parsed->get_header("date");
+    ASSERT_TRUE(date.has_value());
+    EXPECT_EQ(date->size(), 29);
+    EXPECT_EQ(parsed->body, "pong");
+    EXPECT_EQ(*parsed->get_header("content-length"), "4");
+}
+
+TEST_F(Http1EncoderTest, BodyStreamChunkedFraming) {
+    auto stream = body_stream::chunked();
+
+    // 按调用方提供的分片逐块产出分块头/尾，正文字节不经过编码器
+    std::string payload = "hello world";
+    auto frame = stream.next(payload.size());
+    EXPECT_EQ(frame.prefix, "b\r\n");
+    EXPECT_EQ(frame.payload, payload.size());
+    EXPECT_EQ(frame.suffix, "\r\n");
+
+    auto frame2 = stream.next(0x1000);
+    EXPECT_EQ(frame2.prefix, "1000\r\n");
+    EXPECT_EQ(frame2.payload, 0x1000u);
+
+    EXPECT_EQ(stream.bytes_framed(), payload.size() + 0x1000u);
+    EXPECT_EQ(stream.finish(), "0\r\n\r\n");
+    EXPECT_TRUE(stream.finished());
+
+    // 结束后不再产出分片
+    EXPECT_EQ(stream.next(64).payload, 0u);
+    EXPECT_TRUE(stream.finish().empty());
+}
+
+TEST_F(Http1EncoderTest, BodyStreamContentLengthClampsPayload) {
+    auto stream = body_stream::content_length(10);
+
+    auto frame = stream.next(8);
+    EXPECT_TRUE(frame.prefix.empty());
+    EXPECT_TRUE(frame.suffix.empty());
+    EXPECT_EQ(frame.payload, 8u);
+
+    // 超出声明长度的部分被截断
+    auto frame2 = stream.next(100);
+    EXPECT_EQ(frame2.payload, 2u);
+    EXPECT_EQ(stream.next(100).payload, 0u);
+
+    EXPECT_EQ(stream.bytes_framed(), 10u);
+    EXPECT_TRUE(stream.finish().empty());
+}
+
+TEST_F(Http1EncoderTest, BodyStreamH2DataHonorsMaxFrameSize) {
+    auto stream = body_stream::h2_data(5, 16384);
+
+    // 大于max_frame_size的窗口被拆分为多个DATA帧
+    auto frame = stream.next(20000);
+    ASSERT_EQ(frame.prefix.size(), 9u);
+    EXPECT_EQ(frame.payload, 16384u);
+    const auto* header = reinterpret_cast<const uint8_t*>(frame.prefix.data());
+    uint32_t length = (static_cast<uint32_t>(header[0]) << 16) |
+                      (static_cast<uint32_t>(header[1]) << 8) | header[2];
+    EXPECT_EQ(length, 16384u);
+    EXPECT_EQ(header[3], 0x00); // DATA
+    EXPECT_EQ(header[4], 0x00); // 中间帧无标志
+    EXPECT_EQ(header[8], 5);    // stream id
+
+    // 终结帧：零长度DATA + END_STREAM
+    auto terminator = stream.finish();
+    ASSERT_EQ(terminator.size(), 9u);
+    const auto* end_header = reinterpret_cast<const uint8_t*>(terminator.data());
+    EXPECT_EQ(end_header[0] | end_header[1] | end_header[2], 0);
+    EXPECT_EQ(end_header[4], 0x01); // END_STREAM
+}
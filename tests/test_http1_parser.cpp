@@ -376,4 +376,399 @@ TEST_F(Http1ParserTest, StreamingParserIncremental) {
     EXPECT_EQ(req.method_type, method::get);
     EXPECT_EQ(req.target, "/api/test");
     EXPECT_EQ(req.body, "hello world");
-}
\ No newline at end of file
+}
+// =============================================================================
+// 零拷贝视图解析测试
+// =============================================================================
+
+TEST_F(Http1ParserTest, ParseRequestViewZeroCopy) {
+    std::string request_data = 
+        "GET /api/users HTTP/1.1\r\n"
+        "Host: api.example.com\r\n"
+        "Content-Length: 5\r\n"
+        "\r\n"
+        "hello";
+    
+    auto result = http1::parse_request_view(request_data);
+    
+    ASSERT_TRUE(result.has_value());
+    const auto& req = result.value();
+    
+    EXPECT_EQ(req.method_type, method::get);
+    EXPECT_EQ(req.uri, "/api/users");
+    EXPECT_EQ(req.protocol_version, version::http_1_1);
+    EXPECT_EQ(req.headers.size(), 2);
+    EXPECT_EQ(req.body, "hello");
+    
+    // 所有视图必须指向原始缓冲区内部（零拷贝）
+    const char* begin = request_data.data();
+    const char* end = begin + request_data.size();
+    EXPECT_GE(req.uri.data(), begin);
+    EXPECT_LE(req.uri.data() + req.uri.size(), end);
+    for (const auto& h : req.headers) {
+        EXPECT_GE(h.name.data(), begin);
+        EXPECT_LE(h.value.data() + h.value.size(), end);
+    }
+    EXPECT_GE(req.body.data(), begin);
+}
+
+TEST_F(Http1ParserTest, RequestViewCaseInsensitiveHeaderLookup) {
+    std::string request_data = 
+        "GET / HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "\r\n";
+    
+    auto result = http1::parse_request_view(request_data);
+    
+    ASSERT_TRUE(result.has_value());
+    // 视图保留原始大小写，查找不区分大小写
+    auto host = result->get_header("HOST");
+    ASSERT_TRUE(host.has_value());
+    EXPECT_EQ(*host, "example.com");
+}
+
+TEST_F(Http1ParserTest, SelectiveHeaderExtraction) {
+    // 编译期选择头部：只有被点名的头部进入存储，其余全部跳过
+    std::string request_data =
+        "POST /route HTTP/1.1\r\n"
+        "Host: gw.example.com\r\n"
+        "User-Agent: lb-probe\r\n"
+        "Accept: */*\r\n"
+        "X-Route-Key: shard-7\r\n"
+        "X-Trace-Id: abc123\r\n"
+        "Content-Length: 4\r\n"
+        "\r\n"
+        "body";
+
+    parser p(version::http_1_1);
+    auto result = p.parse_request_select<"host", "x-route-key">(request_data);
+
+    ASSERT_TRUE(result.has_value());
+    const auto& req = result.value();
+    EXPECT_EQ(req.method_type, method::post);
+    EXPECT_EQ(req.uri, "/route");
+
+    // 六个头部只存了两个；匹配不区分大小写
+    ASSERT_EQ(req.headers.size(), 2);
+    EXPECT_EQ(req.get_header("host"), "gw.example.com");
+    EXPECT_EQ(req.get_header("x-route-key"), "shard-7");
+    EXPECT_FALSE(req.has_header("user-agent"));
+
+    // content-length未被选择，但仍然约束正文边界
+    EXPECT_EQ(req.body, "body");
+}
+
+TEST_F(Http1ParserTest, SelectiveExtractionResponseAndIncompleteBody) {
+    parser p(version::http_1_1);
+
+    auto resp = p.parse_response_select<"content-type">(
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain\r\n"
+        "Server: unit\r\n"
+        "Content-Length: 2\r\n"
+        "\r\n"
+        "ok");
+    ASSERT_TRUE(resp.has_value());
+    EXPECT_EQ(resp->status_code, 200);
+    ASSERT_EQ(resp->headers.size(), 1);
+    EXPECT_EQ(resp->get_header("content-type"), "text/plain");
+    EXPECT_EQ(resp->body, "ok");
+
+    // 正文不完整：即使content-length被跳过存储也要报need_more_data
+    auto partial = p.parse_request_select<"host">(
+        "GET / HTTP/1.1\r\nHost: a\r\nContent-Length: 10\r\n\r\nabc");
+    ASSERT_FALSE(partial.has_value());
+    EXPECT_EQ(partial.error(), error_code::need_more_data);
+}
+
+TEST_F(Http1ParserTest, HeaderLookupFoldsOnlyAsciiLetters) {
+    // 名字长度跨越多个8字节字，混合大小写查找必须命中
+    std::string request_data =
+        "GET / HTTP/1.1\r\n"
+        "X-Custom-Tracing-Header-Name: abc\r\n"
+        "\r\n";
+
+    auto result = http1::parse_request_view(request_data);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->get_header("x-cUSTOM-tRACING-hEADER-nAME").has_value());
+
+    // '@'(0x40)与'`'(0x60)只差0x20但都不是字母，大小写折叠不得混同
+    request req;
+    req.add_header("x`name", "1");
+    EXPECT_TRUE(req.has_header("x`name"));
+    EXPECT_FALSE(req.has_header("x@name"));
+}
+
+TEST_F(Http1ParserTest, ParseResponseView) {
+    std::string response_data = 
+        "HTTP/1.1 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 9\r\n"
+        "\r\n"
+        "not found";
+    
+    auto result = http1::parse_response_view(response_data);
+    
+    ASSERT_TRUE(result.has_value());
+    const auto& resp = result.value();
+    
+    EXPECT_EQ(resp.status_code, 404);
+    EXPECT_EQ(resp.reason_phrase, "Not Found");
+    EXPECT_EQ(resp.headers.size(), 2);
+    EXPECT_EQ(resp.body, "not found");
+}
+
+TEST_F(Http1ParserTest, ParseRequestViewNeedMoreData) {
+    auto result = http1::parse_request_view("GET /api HTTP/1.1\r\nHost: ex");
+    
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), error_code::need_more_data);
+}
+
+// =============================================================================
+// 流式正文回调测试
+// =============================================================================
+
+TEST_F(Http1ParserTest, BodyCallbackContentLength) {
+    parser p(version::http_1_1);
+
+    std::string received;
+    bool finished = false;
+    p.set_body_callback([&](std::span<const char> data, bool final) {
+        received.append(data.data(), data.size());
+        finished = final;
+    });
+
+    std::string request_data =
+        "POST /upload HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "Content-Length: 5\r\n"
+        "\r\n"
+        "hello";
+
+    auto result = p.parse_request(request_data);
+    ASSERT_TRUE(result.has_value());
+
+    // 回调模式下正文不再复制到message::body
+    EXPECT_TRUE(result->body.empty());
+    EXPECT_EQ(received, "hello");
+    EXPECT_TRUE(finished);
+}
+
+TEST_F(Http1ParserTest, BodyCallbackChunkedDecoding) {
+    parser p(version::http_1_1);
+
+    std::vector<std::string> chunks;
+    bool finished = false;
+    p.set_body_callback([&](std::span<const char> data, bool final) {
+        if (!data.empty()) {
+            chunks.emplace_back(data.data(), data.size());
+        }
+        finished = final;
+    });
+
+    std::string request_data =
+        "POST /upload HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "5\r\n"
+        "hello\r\n"
+        "6\r\n"
+        " world\r\n"
+        "0\r\n"
+        "\r\n";
+
+    auto result = p.parse_request(request_data);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->body.empty());
+
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(chunks[0], "hello");
+    EXPECT_EQ(chunks[1], " world");
+    EXPECT_TRUE(finished);
+}
+
+TEST_F(Http1ParserTest, BodyCallbackIncompleteChunkNeedsMoreData) {
+    parser p(version::http_1_1);
+    p.set_body_callback([](std::span<const char>, bool) {});
+
+    std::string request_data =
+        "POST /upload HTTP/1.1\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "a\r\n"
+        "hel";
+
+    auto result = p.parse_request(request_data);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), error_code::need_more_data);
+}
+
+// =============================================================================
+// 解析统计计数器测试
+// =============================================================================
+
+TEST_F(Http1ParserTest, ParserStatsSectionByteCounts) {
+    parser p(version::http_1_1);
+
+    std::string request_data =
+        "GET /api HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "Content-Length: 5\r\n"
+        "\r\n"
+        "hello";
+
+    auto result = p.parse_request(request_data);
+    ASSERT_TRUE(result.has_value());
+
+    // 各分段字节数之和应覆盖整条报文
+    const auto& stats = p.get_stats();
+    EXPECT_EQ(stats.requests_parsed, 1);
+    EXPECT_EQ(stats.start_line_bytes, 19); // "GET /api HTTP/1.1\r\n"
+    EXPECT_EQ(stats.body_bytes, 5);
+    EXPECT_EQ(stats.header_bytes, request_data.size() - 19 - 5);
+    EXPECT_EQ(stats.parse_errors, 0);
+
+    // need_more_data 不计入解析错误，真正的格式错误才计入
+    ASSERT_FALSE(p.parse_request("GET /api HTTP/1.1\r\nHost: ex").has_value());
+    EXPECT_EQ(p.get_stats().parse_errors, 0);
+    ASSERT_FALSE(p.parse_request("BROKEN\r\n\r\n").has_value());
+    EXPECT_EQ(p.get_stats().parse_errors, 1);
+
+    p.reset_stats();
+    EXPECT_EQ(p.get_stats().requests_parsed, 0);
+    EXPECT_EQ(p.get_stats().parse_errors, 0);
+}
+
+TEST_F(Http1ParserTest, IncrementalParserResumesByteByByte) {
+    http1::request_parser parser;
+
+    std::string request_data =
+        "POST /upload HTTP/1.1\r\n"
+        "Host: example.com\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "4\r\n"
+        "Wiki\r\n"
+        "5\r\n"
+        "pedia\r\n"
+        "0\r\n"
+        "\r\n";
+
+    // 逐字节喂入：每次调用只消耗新字节，绝不重扫已消耗的输入
+    request req;
+    size_t total_consumed = 0;
+    for (char c : request_data) {
+        auto result = parser.parse(std::string_view(&c, 1), req);
+        ASSERT_TRUE(result.has_value());
+        total_consumed += result.value();
+    }
+
+    EXPECT_TRUE(parser.is_complete());
+    EXPECT_EQ(total_consumed, request_data.size());
+    EXPECT_EQ(req.method_type, method::post);
+    EXPECT_EQ(req.body, "Wikipedia");
+
+    // reset后可在保持连接上解析下一条消息
+    parser.reset();
+    request next;
+    auto result = parser.parse(std::string_view("GET / HTTP/1.1\r\n\r\n"), next);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(parser.is_complete());
+    EXPECT_EQ(next.method_type, method::get);
+}
+
+TEST_F(Http1ParserTest, IntegerKernelsRoundTrip) {
+    char buf[20];
+
+    // 十进制：两位查表itoa与全量校验atoi互为逆运算
+    for (uint64_t v : {0ull, 7ull, 42ull, 100ull, 999ull, 65535ull,
+                       1000000007ull, 9999999999999999999ull}) {
+        std::string_view text(buf, co::http::detail::format_decimal(buf, v) - buf);
+        uint64_t parsed = 0;
+        ASSERT_TRUE(co::http::detail::parse_decimal_u64(text, parsed)) << text;
+        EXPECT_EQ(parsed, v);
+    }
+
+    // 十六进制（分块大小格式：小写、无前导零）
+    EXPECT_EQ(std::string_view(buf, co::http::detail::format_hex(buf, 0) - buf), "0");
+    EXPECT_EQ(std::string_view(buf, co::http::detail::format_hex(buf, 0xabcdef) - buf), "abcdef");
+    uint64_t parsed = 0;
+    ASSERT_TRUE(co::http::detail::parse_hex_u64("1A2b", parsed));
+    EXPECT_EQ(parsed, 0x1a2bu);
+
+    // 非法输入整体拒绝：空串、混入非数字、超长
+    EXPECT_FALSE(co::http::detail::parse_decimal_u64("", parsed));
+    EXPECT_FALSE(co::http::detail::parse_decimal_u64("12abc", parsed));
+    EXPECT_FALSE(co::http::detail::parse_decimal_u64("99999999999999999999", parsed));
+    EXPECT_FALSE(co::http::detail::parse_hex_u64("0x10", parsed));
+    EXPECT_FALSE(co::http::detail::parse_hex_u64("fffffffffffffffff", parsed));
+}
+
+TEST_F(Http1ParserTest, ChunkSizeWithNonHexByteRejected) {
+    parser p;
+    request req;
+    std::string data = "POST /upload HTTP/1.1\r\n"
+                       "Transfer-Encoding: chunked\r\n\r\n"
+                       "5g\r\nhello\r\n0\r\n\r\n";
+    auto result = p.parse_request_incremental(
+        std::span<const char>(data.data(), data.size()), req);
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), error_code::invalid_body);
+}
+
+TEST_F(Http1ParserTest, UpgradeResponseSwitchesToPassthrough) {
+    parser p;
+    std::string head = "HTTP/1.1 101 Switching Protocols\r\n"
+                       "Upgrade: websocket\r\n"
+                       "Connection: Upgrade\r\n\r\n";
+    std::string wire = head + "\x81\x05hello"; // 升级后的WebSocket帧字节
+
+    response resp;
+    auto consumed = p.parse_response_incremental(
+        std::span<const char>(wire.data(), wire.size()), resp);
+    ASSERT_TRUE(consumed.has_value());
+
+    // 101响应头之后的字节属于切换后的协议，解析器在边界处停止消费
+    EXPECT_EQ(*consumed, head.size());
+    EXPECT_TRUE(p.is_upgraded());
+    EXPECT_TRUE(p.is_parse_complete());
+    EXPECT_EQ(resp.status_code, 101u);
+
+    // 隧道模式下输入原样穿透：整个span报告为已消费，转发给body回调
+    std::string forwarded;
+    p.set_body_callback([&](std::span<const char> data, bool) {
+        forwarded.append(data.data(), data.size());
+    });
+    std::string opaque = "\x82\x03raw";
+    auto passed = p.parse_response_incremental(
+        std::span<const char>(opaque.data(), opaque.size()), resp);
+    ASSERT_TRUE(passed.has_value());
+    EXPECT_EQ(*passed, opaque.size());
+    EXPECT_EQ(forwarded, opaque);
+
+    // reset() 退出隧道模式
+    p.reset();
+    EXPECT_FALSE(p.is_upgraded());
+}
+
+TEST_F(Http1ParserTest, EnterTunnelModeForConnect) {
+    parser p;
+    EXPECT_FALSE(p.is_upgraded());
+
+    // CONNECT 隧道由代理自己建立（收到2xx后），显式切换
+    p.enter_tunnel_mode();
+    EXPECT_TRUE(p.is_upgraded());
+
+    request req;
+    std::string opaque = "arbitrary tls bytes";
+    auto consumed = p.parse_request_incremental(
+        std::span<const char>(opaque.data(), opaque.size()), req);
+    ASSERT_TRUE(consumed.has_value());
+    EXPECT_EQ(*consumed, opaque.size());
+
+    // 穿透不触碰消息对象
+    EXPECT_TRUE(req.body.empty());
+    EXPECT_TRUE(req.headers.empty());
+}
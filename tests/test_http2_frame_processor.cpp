@@ -139,6 +139,69 @@ TEST_F(Http2FrameProcessorTest, ProcessHeadersFrame) {
     EXPECT_EQ(result.value(), frame.size());
 }
 
+TEST_F(Http2FrameProcessorTest, SingleFragmentHeadersDecodeInPlace) {
+    // 绝大多数HEADERS帧带END_HEADERS：直接从输入载荷就地HPACK解码，
+    // 不经过header_block_buffer_的拷贝
+    std::vector<co::http::header> decoded;
+    processor->set_headers_callback([&](uint32_t stream_id, const std::vector<co::http::header>& headers, bool end_stream, bool end_headers) {
+        EXPECT_EQ(stream_id, 3);
+        EXPECT_FALSE(end_stream);
+        EXPECT_TRUE(end_headers);
+        decoded = headers;
+    });
+
+    std::vector<uint8_t> headers_data = {
+        0x82, // :method: GET (indexed)
+        0x84, // :path: / (indexed)
+    };
+    auto frame = CreateFrame(frame_type::headers,
+                           static_cast<uint8_t>(frame_flags::end_headers),
+                           3, headers_data);
+
+    auto result = processor->process_frames(std::span<const uint8_t>(frame));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), frame.size());
+
+    ASSERT_EQ(decoded.size(), 2);
+    EXPECT_EQ(decoded[0].name, ":method");
+    EXPECT_EQ(decoded[0].value, "GET");
+    EXPECT_EQ(decoded[1].name, ":path");
+    EXPECT_EQ(decoded[1].value, "/");
+}
+
+TEST_F(Http2FrameProcessorTest, HeadersWithContinuationReassembled) {
+    // 罕见的多分片路径：首帧不带END_HEADERS，分片在缓冲区中重组后解码
+    std::vector<co::http::header> decoded;
+    int callbacks = 0;
+    processor->set_headers_callback([&](uint32_t stream_id, const std::vector<co::http::header>& headers, bool, bool) {
+        EXPECT_EQ(stream_id, 5);
+        decoded = headers;
+        ++callbacks;
+    });
+
+    std::vector<uint8_t> block = {
+        0x82, // :method: GET (indexed)
+        0x87, // :scheme: https (indexed)
+        0x84, // :path: / (indexed)
+    };
+    std::vector<uint8_t> first(block.begin(), block.begin() + 1);
+    std::vector<uint8_t> rest(block.begin() + 1, block.end());
+
+    auto headers_frame = CreateFrame(frame_type::headers, 0, 5, first);
+    auto continuation = CreateFrame(frame_type::continuation,
+                                  static_cast<uint8_t>(frame_flags::end_headers),
+                                  5, rest);
+
+    ASSERT_TRUE(processor->process_frames(std::span<const uint8_t>(headers_frame)).has_value());
+    EXPECT_EQ(callbacks, 0); // 头块未完整，不得提前回调
+
+    ASSERT_TRUE(processor->process_frames(std::span<const uint8_t>(continuation)).has_value());
+    ASSERT_EQ(callbacks, 1);
+    ASSERT_EQ(decoded.size(), 3);
+    EXPECT_EQ(decoded[1].name, ":scheme");
+    EXPECT_EQ(decoded[1].value, "https");
+}
+
 TEST_F(Http2FrameProcessorTest, ProcessSettingsFrame) {
     // 设置回调
     processor->set_settings_callback([this](const std::vector<co::http::v2::setting>& settings) {
@@ -387,6 +450,59 @@ TEST_F(Http2FrameProcessorTest, SettingsAcknowledgment) {
     EXPECT_TRUE(settings_ack_received);
 }
 
+TEST_F(Http2FrameProcessorTest, GenerateSettingsFrameFromFixedArray) {
+    // 连接建立路径用定长数组生成SETTINGS，不经过哈希表
+    connection_settings settings;
+    settings.max_frame_size = 32768;
+    settings.enable_push = false;
+
+    std::array<setting, connection_settings::max_settings> entries;
+    size_t count = settings.serialize_nondefault(entries);
+    ASSERT_EQ(count, 2); // 只序列化偏离RFC默认值的条目
+
+    co::http::output_buffer buffer;
+    auto result = processor->generate_settings_frame(
+        std::span<const setting>(entries.data(), count), false, buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 9 + count * 6);
+    EXPECT_EQ(buffer.size(), 9 + count * 6);
+
+    // 往返：对端处理后应得到相同的设置值
+    frame_processor peer;
+    ASSERT_TRUE(peer.process_frames(buffer.span()).has_value());
+    EXPECT_EQ(peer.get_settings().max_frame_size, 32768);
+    EXPECT_FALSE(peer.get_settings().enable_push);
+
+    // 全默认设置：无需传输任何条目
+    connection_settings defaults;
+    EXPECT_EQ(defaults.serialize_nondefault(entries), 0);
+}
+
+TEST_F(Http2FrameProcessorTest, ClientPreambleIsPrecomputedBlob) {
+    auto preamble = frame_processor::client_preamble();
+    ASSERT_EQ(preamble.size(), connection_preface.size() + frame_header::size);
+
+    // 前24字节是连接前置魔数
+    EXPECT_EQ(std::memcmp(preamble.data(), connection_preface.data(),
+                          connection_preface.size()), 0);
+
+    // 随后是空载荷的初始SETTINGS帧
+    auto header = frame_header::parse(preamble.data() + connection_preface.size());
+    EXPECT_EQ(header.type, static_cast<uint8_t>(frame_type::settings));
+    EXPECT_EQ(header.length, 0);
+    EXPECT_EQ(header.stream_id, 0);
+
+    // 跨连接复用同一块不可变存储
+    EXPECT_EQ(preamble.data(), frame_processor::client_preamble().data());
+
+    // 服务端按正常接收路径消化整个前导
+    frame_processor server;
+    ASSERT_TRUE(server.process_connection_preface(
+        preamble.subspan(0, connection_preface.size())).has_value());
+    EXPECT_TRUE(server.process_frames(
+        preamble.subspan(connection_preface.size())).has_value());
+}
+
 TEST_F(Http2FrameProcessorTest, PingAcknowledgment) {
     bool ping_ack_received = false;
     
@@ -593,4 +709,454 @@ TEST_F(Http2FrameProcessorTest, UnknownFrameType) {
     EXPECT_EQ(received_frames[0].header.type, 0xFF);
     EXPECT_EQ(received_frames[0].header.stream_id, 1);
     EXPECT_EQ(received_frames[0].payload, unknown_payload);
-}
\ No newline at end of file
+}
+TEST_F(Http2FrameProcessorTest, ProcessDataFrameZeroCopyFastPath) {
+    // 完整帧应直接派发输入缓冲区中的载荷切片，不经过内部拷贝
+    const uint8_t* dispatched_ptr = nullptr;
+    processor->set_data_callback([&](uint32_t, std::span<const uint8_t> data, bool) {
+        dispatched_ptr = data.data();
+    });
+
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    std::string test_data = "zero copy payload";
+    std::vector<uint8_t> payload(test_data.begin(), test_data.end());
+    auto frame = CreateFrame(frame_type::data,
+                           static_cast<uint8_t>(frame_flags::end_stream),
+                           1, payload);
+
+    auto result = processor->process_frames(std::span<const uint8_t>(frame));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), frame.size());
+    EXPECT_EQ(dispatched_ptr, frame.data() + 9);
+}
+
+TEST_F(Http2FrameProcessorTest, ProcessDataFrameSplitAcrossReads) {
+    // 跨读分段的帧走缓冲回退路径，载荷需完整重组后再派发
+    processor->set_data_callback([this](uint32_t stream_id, std::span<const uint8_t> data, bool end_stream) {
+        OnData(stream_id, data, end_stream);
+    });
+
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    std::string test_data = "split across two reads";
+    std::vector<uint8_t> payload(test_data.begin(), test_data.end());
+    auto frame = CreateFrame(frame_type::data,
+                           static_cast<uint8_t>(frame_flags::end_stream),
+                           1, payload);
+
+    // 第一段：帧头 + 载荷前5字节
+    size_t first_part = 9 + 5;
+    auto result1 = processor->process_frames(
+        std::span<const uint8_t>(frame.data(), first_part));
+    ASSERT_TRUE(result1.has_value());
+    EXPECT_EQ(result1.value(), first_part);
+    EXPECT_TRUE(received_data.empty());
+
+    // 第二段：剩余载荷
+    auto result2 = processor->process_frames(
+        std::span<const uint8_t>(frame.data() + first_part, frame.size() - first_part));
+    ASSERT_TRUE(result2.has_value());
+    EXPECT_EQ(result2.value(), frame.size() - first_part);
+
+    ASSERT_EQ(received_data.size(), 1);
+    EXPECT_EQ(received_data[0].data, payload);
+    EXPECT_TRUE(received_data[0].end_stream);
+}
+
+TEST_F(Http2FrameProcessorTest, ProcessBackToBackFramesReportsAllBytes) {
+    // 同一输入中的连续帧必须逐个推进，消费字节数为两帧总长
+    processor->set_data_callback([this](uint32_t stream_id, std::span<const uint8_t> data, bool end_stream) {
+        OnData(stream_id, data, end_stream);
+    });
+
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    std::vector<uint8_t> p1 = {'a', 'b', 'c', 'd'};
+    std::vector<uint8_t> p2 = {'e', 'f'};
+    auto f1 = CreateFrame(frame_type::data, 0, 1, p1);
+    auto f2 = CreateFrame(frame_type::data,
+                          static_cast<uint8_t>(frame_flags::end_stream), 1, p2);
+    std::vector<uint8_t> wire(f1);
+    wire.insert(wire.end(), f2.begin(), f2.end());
+
+    auto result = processor->process_frames(std::span<const uint8_t>(wire));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), wire.size());
+
+    ASSERT_EQ(received_data.size(), 2);
+    EXPECT_EQ(received_data[0].data, p1);
+    EXPECT_EQ(received_data[1].data, p2);
+}
+
+// =============================================================================
+// 流量控制合并 WINDOW_UPDATE 测试
+// =============================================================================
+
+TEST_F(Http2FrameProcessorTest, ConsumeDataBelowThresholdEmitsNothing) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+    processor->set_window_update_threshold(1000);
+
+    co::http::output_buffer out;
+    auto result = processor->consume_data(1, 400, out);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 0);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST_F(Http2FrameProcessorTest, ConsumeDataCoalescesWindowUpdates) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+    processor->set_window_update_threshold(1000);
+
+    co::http::output_buffer out;
+    ASSERT_TRUE(processor->consume_data(1, 600, out).has_value());
+    EXPECT_TRUE(out.empty());
+
+    // 第二次消费越过阈值：流级与连接级各一个 WINDOW_UPDATE，增量为累计值
+    auto result = processor->consume_data(1, 600, out);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 2 * (9 + 4));
+
+    auto span = out.span();
+    ASSERT_EQ(span.size(), 26);
+    auto stream_frame = frame_header::parse(span.data());
+    EXPECT_EQ(stream_frame.type, static_cast<uint8_t>(frame_type::window_update));
+    EXPECT_EQ(stream_frame.stream_id, 1);
+    uint32_t stream_increment = (static_cast<uint32_t>(span[9]) << 24) |
+                                (static_cast<uint32_t>(span[10]) << 16) |
+                                (static_cast<uint32_t>(span[11]) << 8) |
+                                static_cast<uint32_t>(span[12]);
+    EXPECT_EQ(stream_increment, 1200);
+
+    auto conn_frame = frame_header::parse(span.data() + 13);
+    EXPECT_EQ(conn_frame.type, static_cast<uint8_t>(frame_type::window_update));
+    EXPECT_EQ(conn_frame.stream_id, 0);
+
+    // 计数器清零后再次累计，不会立即重复发送
+    co::http::output_buffer out2;
+    ASSERT_TRUE(processor->consume_data(1, 400, out2).has_value());
+    EXPECT_TRUE(out2.empty());
+}
+
+TEST_F(Http2FrameProcessorTest, ConsumeDataRestoresReceiveWindow) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+    processor->set_data_callback([](uint32_t, std::span<const uint8_t>, bool) {});
+    processor->set_window_update_threshold(10);
+
+    // 收到 DATA 帧会扣减接收窗口
+    std::vector<uint8_t> payload(64, 'd');
+    auto frame = CreateFrame(frame_type::data, 0, 1, payload);
+    ASSERT_TRUE(processor->process_frames(std::span<const uint8_t>(frame)).has_value());
+
+    auto* stream = processor->get_stream_manager().get_stream(1);
+    ASSERT_NE(stream, nullptr);
+    int32_t debited = stream->window_size;
+
+    // 消费并越过阈值后，窗口应加回同等额度
+    co::http::output_buffer out;
+    auto result = processor->consume_data(1, 64, out);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_GT(result.value(), 0);
+    EXPECT_EQ(stream->window_size, debited + 64);
+}
+
+// =============================================================================
+// 多连接批量处理测试
+// =============================================================================
+
+TEST_F(Http2FrameProcessorTest, VectoredProcessFramesWalksBufferBoundaries) {
+    // readv风格输入：帧头跨缓冲区边界、载荷跨缓冲区边界都必须正确处理，
+    // 结果与连续输入完全一致
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+    processor->set_data_callback([this](uint32_t stream_id, std::span<const uint8_t> data, bool end_stream) {
+        OnData(stream_id, data, end_stream);
+    });
+
+    std::vector<uint8_t> payload1 = {'f', 'i', 'r', 's', 't'};
+    std::vector<uint8_t> payload2 = {'s', 'e', 'c', 'o', 'n', 'd'};
+    auto frame1 = CreateFrame(frame_type::data, 0, 1, payload1);
+    auto frame2 = CreateFrame(frame_type::data,
+                            static_cast<uint8_t>(frame_flags::end_stream), 1, payload2);
+
+    std::vector<uint8_t> stream;
+    stream.insert(stream.end(), frame1.begin(), frame1.end());
+    stream.insert(stream.end(), frame2.begin(), frame2.end());
+
+    // 切分点落在第一帧载荷中间和第二帧帧头中间
+    std::vector<std::span<const uint8_t>> buffers = {
+        std::span<const uint8_t>(stream.data(), 12),
+        std::span<const uint8_t>(stream.data() + 12, 6),
+        std::span<const uint8_t>(stream.data() + 18, stream.size() - 18),
+    };
+
+    auto result = processor->process_frames(std::span<const std::span<const uint8_t>>(buffers));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), stream.size());
+
+    ASSERT_EQ(received_data.size(), 2);
+    EXPECT_EQ(received_data[0].data, payload1);
+    EXPECT_EQ(received_data[1].data, payload2);
+    EXPECT_TRUE(received_data[1].end_stream);
+}
+
+TEST_F(Http2FrameProcessorTest, VectoredProcessFramesInPlaceWhenWholeFrameInBuffer) {
+    // 整帧落在单个缓冲区内时，载荷就地分发（指针指向调用方缓冲区）
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+    const uint8_t* dispatched = nullptr;
+    processor->set_data_callback([&](uint32_t, std::span<const uint8_t> data, bool) {
+        dispatched = data.data();
+    });
+
+    std::vector<uint8_t> payload = {'z', 'e', 'r', 'o'};
+    auto frame = CreateFrame(frame_type::data, 0, 1, payload);
+    std::vector<std::span<const uint8_t>> buffers = {std::span<const uint8_t>(frame)};
+
+    ASSERT_TRUE(processor->process_frames(std::span<const std::span<const uint8_t>>(buffers)).has_value());
+    EXPECT_EQ(dispatched, frame.data() + 9);
+}
+
+TEST_F(Http2FrameProcessorTest, BatchProcessingMatchesPerConnectionResults) {
+    // 三个独立连接，每个连接的输入里有两个DATA帧
+    constexpr int kConnections = 3;
+    std::vector<std::unique_ptr<frame_processor>> processors;
+    std::vector<std::vector<uint8_t>> inputs;
+    std::vector<std::vector<std::string>> received(kConnections);
+
+    for (int i = 0; i < kConnections; ++i) {
+        auto p = std::make_unique<frame_processor>();
+        ASSERT_TRUE(p->get_stream_manager().create_stream(1).has_value());
+        p->set_data_callback([&received, i](uint32_t, std::span<const uint8_t> data, bool) {
+            received[i].emplace_back(reinterpret_cast<const char*>(data.data()), data.size());
+        });
+
+        std::string first = "conn" + std::to_string(i) + "-a";
+        std::string second = "conn" + std::to_string(i) + "-b";
+        auto frame1 = CreateFrame(frame_type::data, 0, 1,
+                                  std::vector<uint8_t>(first.begin(), first.end()));
+        auto frame2 = CreateFrame(frame_type::data,
+                                  static_cast<uint8_t>(frame_flags::end_stream), 1,
+                                  std::vector<uint8_t>(second.begin(), second.end()));
+        frame1.insert(frame1.end(), frame2.begin(), frame2.end());
+        inputs.push_back(std::move(frame1));
+        processors.push_back(std::move(p));
+    }
+
+    std::vector<frame_processor::batch_item> items;
+    for (int i = 0; i < kConnections; ++i) {
+        items.push_back({processors[i].get(), std::span<const uint8_t>(inputs[i])});
+    }
+    frame_processor::process_batch(items);
+
+    for (int i = 0; i < kConnections; ++i) {
+        ASSERT_TRUE(items[i].result.has_value());
+        EXPECT_EQ(items[i].result.value(), inputs[i].size());
+        EXPECT_FALSE(items[i].needs_more_data);
+        ASSERT_EQ(received[i].size(), 2);
+        EXPECT_EQ(received[i][0], "conn" + std::to_string(i) + "-a");
+        EXPECT_EQ(received[i][1], "conn" + std::to_string(i) + "-b");
+        EXPECT_EQ(processors[i]->get_stats().data_frames, 2);
+    }
+}
+
+TEST_F(Http2FrameProcessorTest, BatchProcessingIsolatesErrorsAndPartialInput) {
+    // 一个连接出错、一个帧被截断，均不影响批内其他连接
+    frame_processor good, bad, partial;
+    ASSERT_TRUE(good.get_stream_manager().create_stream(1).has_value());
+    ASSERT_TRUE(partial.get_stream_manager().create_stream(1).has_value());
+
+    std::string data = "payload";
+    auto good_input = CreateFrame(frame_type::data,
+                                  static_cast<uint8_t>(frame_flags::end_stream), 1,
+                                  std::vector<uint8_t>(data.begin(), data.end()));
+    // 未创建流的DATA帧触发协议错误
+    auto bad_input = CreateFrame(frame_type::data, 0, 99,
+                                 std::vector<uint8_t>(data.begin(), data.end()));
+    // 截断：只给帧头和一半载荷
+    auto truncated = CreateFrame(frame_type::data, 0, 1,
+                                 std::vector<uint8_t>(data.begin(), data.end()));
+    truncated.resize(truncated.size() - 3);
+
+    std::vector<frame_processor::batch_item> items = {
+        {&good, std::span<const uint8_t>(good_input)},
+        {&bad, std::span<const uint8_t>(bad_input)},
+        {&partial, std::span<const uint8_t>(truncated)},
+    };
+    frame_processor::process_batch(items);
+
+    ASSERT_TRUE(items[0].result.has_value());
+    EXPECT_EQ(items[0].result.value(), good_input.size());
+
+    EXPECT_FALSE(items[1].result.has_value());
+
+    ASSERT_TRUE(items[2].result.has_value());
+    EXPECT_TRUE(items[2].needs_more_data);
+    EXPECT_EQ(items[2].result.value(), truncated.size());
+}
+
+TEST_F(Http2FrameProcessorTest, MemoryBudgetRejectsOversizedSplitFrame) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    // 预算64字节，连接错误策略：跨读积攒的DATA帧超出预算即失败
+    frame_processor::memory_budget budget;
+    budget.max_buffered_bytes = 64;
+    budget.policy = frame_processor::memory_budget::overflow_policy::connection_error;
+    processor->set_memory_budget(budget);
+
+    std::vector<uint8_t> frame = {
+        0x00, 0x00, 0x80,       // length = 128 > 预算
+        0x00,                   // DATA
+        0x00,                   // flags
+        0x00, 0x00, 0x00, 0x01  // stream 1
+    };
+    frame.resize(frame.size() + 100, 0xAB); // 故意只给部分负载，触发慢路径积攒
+
+    auto result = processor->process_frames(std::span<const uint8_t>(frame));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), h2_error_code::enhance_your_calm);
+    EXPECT_EQ(processor->get_stats().budget_overflows, 1u);
+}
+
+TEST_F(Http2FrameProcessorTest, MemoryBudgetBackpressureStallsIntake) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    frame_processor::memory_budget budget;
+    budget.max_buffered_bytes = 64;
+    budget.policy = frame_processor::memory_budget::overflow_policy::backpressure;
+    processor->set_memory_budget(budget);
+
+    std::vector<uint8_t> frame = {
+        0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    };
+    frame.resize(frame.size() + 100, 0xAB);
+
+    // 背压策略：不报错，消费在帧头后停止并置位backpressured()
+    auto result = processor->process_frames(std::span<const uint8_t>(frame));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, frame_header::size);
+    EXPECT_TRUE(processor->backpressured());
+
+    // 提高预算解除背压，剩余字节可继续送入
+    budget.max_buffered_bytes = 1024;
+    processor->set_memory_budget(budget);
+    EXPECT_FALSE(processor->backpressured());
+    auto resumed = processor->process_frames(
+        std::span<const uint8_t>(frame).subspan(*result));
+    ASSERT_TRUE(resumed.has_value());
+    EXPECT_EQ(*resumed, 100u); // 已到手的部分负载全部积攒
+}
+
+TEST_F(Http2FrameProcessorTest, MemoryBudgetCapsContinuationAccumulation) {
+    frame_processor::memory_budget budget;
+    budget.max_buffered_bytes = 16;
+    processor->set_memory_budget(budget);
+
+    // HEADERS不带END_HEADERS：片段将驻留header_block_buffer_，
+    // 超预算的块在帧边界处直接拒绝
+    std::vector<uint8_t> headers_frame = {
+        0x00, 0x00, 0x20,       // length = 32 > 预算16
+        0x01,                   // HEADERS
+        0x00,                   // 无END_HEADERS
+        0x00, 0x00, 0x00, 0x01
+    };
+    headers_frame.resize(headers_frame.size() + 32, 0x00);
+
+    auto result = processor->process_frames(std::span<const uint8_t>(headers_frame));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), h2_error_code::enhance_your_calm);
+}
+
+TEST_F(Http2FrameProcessorTest, StagingBuffersShrinkAfterLargeFrame) {
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    frame_processor::memory_budget budget;
+    budget.max_buffered_bytes = 1024 * 1024;
+    budget.shrink_threshold = 1024; // 低阈值便于观察回收
+    processor->set_memory_budget(budget);
+
+    // 8KB DATA帧分两次送入，迫使frame_buffer_增长后再回收
+    const size_t payload_size = 8192;
+    std::vector<uint8_t> frame = {
+        0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    };
+    frame.resize(frame.size() + payload_size, 0xCD);
+
+    size_t half = frame.size() / 2;
+    auto first = processor->process_frames(
+        std::span<const uint8_t>(frame.data(), half));
+    ASSERT_TRUE(first.has_value());
+    auto second = processor->process_frames(
+        std::span<const uint8_t>(frame.data() + *first, frame.size() - *first));
+    ASSERT_TRUE(second.has_value());
+
+    // 帧完成后高水位容量被释放，驻留字节归零
+    EXPECT_EQ(processor->buffered_bytes(), 0u);
+    EXPECT_GE(processor->get_stats().buffer_shrinks, 1u);
+    EXPECT_GE(processor->get_stats().peak_buffered_bytes, payload_size - frame_header::size);
+}
+
+// 编译期绑定的统计型handler：只覆写关心的事件，其余继承frame_handler的空实现
+struct counting_frame_handler : frame_handler {
+    uint32_t last_data_stream = 0;
+    size_t data_bytes = 0;
+    size_t data_events = 0;
+    size_t ping_events = 0;
+    bool last_end_stream = false;
+
+    void on_data(uint32_t stream_id, std::span<const uint8_t> data, bool end_stream) {
+        last_data_stream = stream_id;
+        data_bytes += data.size();
+        ++data_events;
+        last_end_stream = end_stream;
+    }
+    void on_ping(const std::array<uint8_t, 8>&, bool) { ++ping_events; }
+};
+
+TEST_F(Http2FrameProcessorTest, StaticHandlerDispatchesWithoutStdFunction) {
+    basic_frame_processor<counting_frame_handler> static_processor;
+    ASSERT_TRUE(static_processor.get_stream_manager().create_stream(1).has_value());
+
+    // DATA帧直达handler的on_data，无std::function间接调用
+    std::string test_data = "compile-time dispatch";
+    std::vector<uint8_t> payload(test_data.begin(), test_data.end());
+    auto data_frame = CreateFrame(frame_type::data,
+                                  static_cast<uint8_t>(frame_flags::end_stream),
+                                  1, payload);
+    auto result = static_processor.process_frames(std::span<const uint8_t>(data_frame));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), data_frame.size());
+
+    // PING帧命中覆写的on_ping；未覆写的事件走基类空实现
+    std::vector<uint8_t> ping_payload(8, 0xAB);
+    auto ping_frame = CreateFrame(frame_type::ping, 0, 0, ping_payload);
+    ASSERT_TRUE(static_processor.process_frames(std::span<const uint8_t>(ping_frame)).has_value());
+
+    const auto& handler = static_processor.handler();
+    EXPECT_EQ(handler.data_events, 1u);
+    EXPECT_EQ(handler.last_data_stream, 1u);
+    EXPECT_EQ(handler.data_bytes, payload.size());
+    EXPECT_TRUE(handler.last_end_stream);
+    EXPECT_EQ(handler.ping_events, 1u);
+
+    // 无std::function成员，实例显著小于类型擦除版本
+    EXPECT_LT(sizeof(basic_frame_processor<counting_frame_handler>),
+              sizeof(frame_processor));
+}
+
+TEST_F(Http2FrameProcessorTest, FunctionHandlerAliasPreservesCallbackApi) {
+    // frame_processor是basic_frame_processor<function_handler>的别名，
+    // set_*_callback注册仍然生效（完整覆盖见前面所有用例）
+    static_assert(std::is_same_v<frame_processor,
+                                 basic_frame_processor<function_handler>>);
+    ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+
+    size_t calls = 0;
+    processor->set_data_callback([&](uint32_t, std::span<const uint8_t>, bool) { ++calls; });
+
+    std::vector<uint8_t> payload = {0x01, 0x02, 0x03};
+    auto frame = CreateFrame(frame_type::data, 0, 1, payload);
+    ASSERT_TRUE(processor->process_frames(std::span<const uint8_t>(frame)).has_value());
+    EXPECT_EQ(calls, 1u);
+
+    // handler()开放底层function_handler，未注册的回调为空
+    EXPECT_FALSE(processor->handler().goaway_callback_);
+}
@@ -465,4 +465,120 @@ TEST_F(Http2StreamManagerTest, StreamStatistics) {
     // 获取统计信息
     EXPECT_EQ(manager->total_stream_count(), 3);
     EXPECT_EQ(manager->active_stream_count(), 2); // 1 and 3 are still active
-}
\ No newline at end of file
+}
+// =============================================================================
+// 平坦流表与槽位复用测试
+// =============================================================================
+
+TEST_F(Http2StreamManagerTest, ManyStreamsLookupStaysConsistent) {
+    // 大量流强制索引扩容与探测，查找结果必须保持一致
+    const uint32_t count = 2000;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t id = 2 * i + 1;
+        auto stream = manager->create_stream(id, false);
+        ASSERT_TRUE(stream.has_value());
+    }
+    EXPECT_EQ(manager->active_stream_count(), count);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t id = 2 * i + 1;
+        auto* stream = manager->get_stream(id);
+        ASSERT_NE(stream, nullptr);
+        EXPECT_EQ(stream->id, id);
+    }
+    EXPECT_EQ(manager->get_stream(2 * count + 1), nullptr);
+}
+
+TEST_F(Http2StreamManagerTest, ClosedStreamQueryableUntilCleanup) {
+    // 关闭的流在清扫前仍可查到（帧校验需要区分 stream_closed 与 protocol_error）
+    ASSERT_TRUE(manager->create_stream(1, false).has_value());
+    manager->close_stream(1);
+
+    auto* stream = manager->get_stream(1);
+    ASSERT_NE(stream, nullptr);
+    EXPECT_TRUE(stream->is_closed());
+    EXPECT_EQ(manager->active_stream_count(), 0);
+    EXPECT_EQ(manager->total_stream_count(), 1);
+
+    manager->cleanup_closed_streams();
+    EXPECT_EQ(manager->get_stream(1), nullptr);
+    EXPECT_EQ(manager->total_stream_count(), 0);
+}
+
+TEST_F(Http2StreamManagerTest, SlotReuseAfterCleanup) {
+    // 清扫释放的槽位应被后续流复用，流数据互不串扰
+    ASSERT_TRUE(manager->create_stream(1, false).has_value());
+    manager->close_stream(1);
+    manager->cleanup_closed_streams();
+
+    auto stream = manager->create_stream(3, false);
+    ASSERT_TRUE(stream.has_value());
+    EXPECT_EQ(stream.value()->id, 3);
+    EXPECT_EQ(stream.value()->state, stream_state::open);
+
+    // 旧流ID不能复活
+    EXPECT_EQ(manager->get_stream(1), nullptr);
+    EXPECT_EQ(manager->active_stream_count(), 1);
+}
+
+// =============================================================================
+// 加权优先级调度测试
+// =============================================================================
+
+TEST_F(Http2StreamManagerTest, SchedulerServesByWeight) {
+    // 权重高的流应获得成比例更多的调度轮次
+    ASSERT_TRUE(manager->create_stream(1, false).has_value());
+    ASSERT_TRUE(manager->create_stream(3, false).has_value());
+    manager->set_stream_priority(1, 0, 219, false); // 有效权重 220
+    manager->set_stream_priority(3, 0, 54, false);  // 有效权重 55
+
+    manager->mark_stream_writable(1);
+    manager->mark_stream_writable(3);
+
+    // 模拟发送：每轮给选中的流记账相同字节数
+    int picks_1 = 0, picks_3 = 0;
+    for (int i = 0; i < 100; ++i) {
+        auto next = manager->next_writable_stream();
+        ASSERT_TRUE(next.has_value());
+        if (*next == 1) ++picks_1; else ++picks_3;
+        manager->record_data_sent(*next, 1000);
+    }
+
+    // 220:55 = 4:1，允许调度边界上的少量偏差
+    EXPECT_GT(picks_1, picks_3 * 3);
+}
+
+TEST_F(Http2StreamManagerTest, SchedulerSkipsWindowBlockedStreams) {
+    ASSERT_TRUE(manager->create_stream(1, false).has_value());
+    ASSERT_TRUE(manager->create_stream(3, false).has_value());
+    manager->mark_stream_writable(1);
+    manager->mark_stream_writable(3);
+
+    // 耗尽流1的发送窗口后，调度只能选流3
+    auto* stream1 = manager->get_stream(1);
+    ASSERT_NE(stream1, nullptr);
+    stream1->window_size = 0;
+
+    auto next = manager->next_writable_stream();
+    ASSERT_TRUE(next.has_value());
+    EXPECT_EQ(*next, 3);
+
+    // 窗口恢复后流1重新参与调度
+    stream1->window_size = 1024;
+    manager->record_data_sent(3, 1 << 20); // 把流3的虚拟时间推远
+    next = manager->next_writable_stream();
+    ASSERT_TRUE(next.has_value());
+    EXPECT_EQ(*next, 1);
+}
+
+TEST_F(Http2StreamManagerTest, SchedulerDrainsIdleAndClosedStreams) {
+    ASSERT_TRUE(manager->create_stream(1, false).has_value());
+    manager->mark_stream_writable(1);
+    manager->mark_stream_unwritable(1);
+    EXPECT_FALSE(manager->next_writable_stream().has_value());
+
+    ASSERT_TRUE(manager->create_stream(3, false).has_value());
+    manager->mark_stream_writable(3);
+    manager->close_stream(3);
+    EXPECT_FALSE(manager->next_writable_stream().has_value());
+}
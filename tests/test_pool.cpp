@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "http_parse/pool.hpp"
+#include <string>
+#include <thread>
+#include <utility>
+
+using namespace co::http;
+
+class ParserPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+TEST_F(ParserPoolTest, HandleReturnsInstanceToPoolOnDestruction) {
+    parser_pool pool;
+    EXPECT_EQ(pool.idle_count(), 0u);
+
+    {
+        auto handle = pool.acquire();
+        EXPECT_EQ(pool.idle_count(), 0u);
+    } // handle析构时实例回到池中
+
+    EXPECT_EQ(pool.idle_count(), 1u);
+
+    // 再次获取时复用池中实例，而不是新建
+    auto reused = pool.acquire();
+    EXPECT_EQ(pool.idle_count(), 0u);
+}
+
+TEST_F(ParserPoolTest, ReusedParserIsResetAndKeepsStats) {
+    parser_pool pool;
+    std::string request_data = "GET /first HTTP/1.1\r\nHost: example.com\r\n\r\n";
+
+    {
+        auto handle = pool.acquire();
+        auto result = handle->parse_request(request_data);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(handle->get_stats().requests_parsed, 1u);
+    }
+
+    // 复用的实例：解析状态已重置，可直接解析下一条消息
+    auto handle = pool.acquire();
+    std::string second = "POST /second HTTP/1.1\r\nHost: example.com\r\n"
+                         "Content-Length: 2\r\n\r\nok";
+    auto result = handle->parse_request(second);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->method_type, method::post);
+    EXPECT_EQ(result->body, "ok");
+
+    // 统计计数跨复用保留，证明是同一个实例
+    EXPECT_EQ(handle->get_stats().requests_parsed, 2u);
+}
+
+TEST_F(ParserPoolTest, HandleMoveTransfersOwnership) {
+    parser_pool pool;
+
+    auto first = pool.acquire();
+    auto second = std::move(first);
+
+    auto result = second->parse_request("GET / HTTP/1.1\r\n\r\n");
+    ASSERT_TRUE(result.has_value());
+
+    // 被移出的handle析构不应重复归还实例
+    { auto discard = std::move(second); }
+    EXPECT_EQ(pool.idle_count(), 1u);
+}
+
+TEST_F(ParserPoolTest, LocalPoolIsPerThread) {
+    // 预热本线程的池
+    { auto handle = parser_pool::local().acquire(); }
+    size_t idle_here = parser_pool::local().idle_count();
+    EXPECT_GE(idle_here, 1u);
+
+    // 其他线程看到的是独立的空池
+    size_t idle_other = 0;
+    std::thread worker([&] { idle_other = parser_pool::local().idle_count(); });
+    worker.join();
+    EXPECT_EQ(idle_other, 0u);
+}
+
+TEST_F(ParserPoolTest, EncoderPoolRoundTrip) {
+    encoder_pool pool;
+
+    {
+        auto handle = pool.acquire();
+        request req;
+        req.method_type = method::get;
+        req.uri = "/pooled";
+        req.protocol_version = version::http_1_1;
+        req.add_header("Host", "example.com");
+
+        auto encoded = handle->encode_request(req);
+        ASSERT_TRUE(encoded.has_value());
+        EXPECT_NE(encoded->find("GET /pooled HTTP/1.1"), std::string::npos);
+    }
+
+    EXPECT_EQ(pool.idle_count(), 1u);
+}
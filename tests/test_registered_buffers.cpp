@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "http_parse/v2/registered_buffers.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace co::http::v2;
+
+class RegisteredBuffersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+        processor = std::make_unique<frame_processor>();
+        ASSERT_TRUE(processor->get_stream_manager().create_stream(1).has_value());
+        processor->set_data_callback([this](uint32_t, std::span<const uint8_t> data, bool) {
+            received.emplace_back(reinterpret_cast<const char*>(data.data()), data.size());
+            last_payload_ptr = data.data();
+        });
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+        processor.reset();
+    }
+
+    // 在buffer的offset处写入一个DATA帧，返回帧总长
+    size_t WriteDataFrame(std::vector<uint8_t>& buffer, size_t offset,
+                          uint32_t stream_id, const std::string& data) {
+        uint8_t* p = buffer.data() + offset;
+        p[0] = (data.size() >> 16) & 0xFF;
+        p[1] = (data.size() >> 8) & 0xFF;
+        p[2] = data.size() & 0xFF;
+        p[3] = static_cast<uint8_t>(frame_type::data);
+        p[4] = 0;
+        p[5] = (stream_id >> 24) & 0x7F;
+        p[6] = (stream_id >> 16) & 0xFF;
+        p[7] = (stream_id >> 8) & 0xFF;
+        p[8] = stream_id & 0xFF;
+        std::memcpy(p + 9, data.data(), data.size());
+        return 9 + data.size();
+    }
+
+    std::unique_ptr<frame_processor> processor;
+    std::vector<std::string> received;
+    const uint8_t* last_payload_ptr = nullptr;
+};
+
+TEST_F(RegisteredBuffersTest, WholeFramesDispatchInPlace) {
+    std::vector<uint8_t> buffer(4096);
+    size_t frame_size = WriteDataFrame(buffer, 100, 1, "zero copy ingest");
+
+    registered_buffer_ingest ingest(*processor);
+    ingest.register_buffer(7, buffer);
+
+    auto result = ingest.ingest(7, 100, frame_size);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), frame_size);
+
+    // 载荷直接来自注册缓冲区，没有任何拷贝
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received[0], "zero copy ingest");
+    EXPECT_EQ(last_payload_ptr, buffer.data() + 100 + 9);
+
+    // 没有挂起字节，整个缓冲区都可回收
+    EXPECT_EQ(ingest.pending_bytes(), 0);
+    EXPECT_EQ(ingest.releasable_up_to(7), buffer.size());
+}
+
+TEST_F(RegisteredBuffersTest, ContiguousContinuationStaysZeroCopy) {
+    std::vector<uint8_t> buffer(4096);
+    size_t frame_size = WriteDataFrame(buffer, 0, 1, "split but contiguous");
+
+    registered_buffer_ingest ingest(*processor);
+    ingest.register_buffer(1, buffer);
+
+    // 帧被切成两次到达，但在缓冲区中连续
+    auto first = ingest.ingest(1, 0, 12);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first.value(), 0);          // 帧未完成，全部挂起
+    EXPECT_EQ(ingest.releasable_up_to(1), 0);
+
+    auto second = ingest.ingest(1, 12, frame_size - 12);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second.value(), frame_size);
+
+    // 连续切片合并后仍走原地快速路径
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received[0], "split but contiguous");
+    EXPECT_EQ(last_payload_ptr, buffer.data() + 9);
+    EXPECT_EQ(ingest.pending_bytes(), 0);
+}
+
+TEST_F(RegisteredBuffersTest, SpanningFrameAcrossBuffersAssembledOnce) {
+    // 帧的前半在buffer A末尾，后半在buffer B开头
+    std::vector<uint8_t> scratch(4096);
+    size_t frame_size = WriteDataFrame(scratch, 0, 1, "crosses two fixed buffers");
+
+    size_t split = 15;
+    std::vector<uint8_t> buffer_a(scratch.begin(), scratch.begin() + split);
+    std::vector<uint8_t> buffer_b(scratch.begin() + split, scratch.begin() + frame_size);
+
+    registered_buffer_ingest ingest(*processor);
+    ingest.register_buffer(0, buffer_a);
+    ingest.register_buffer(1, buffer_b);
+
+    auto first = ingest.ingest(0, 0, buffer_a.size());
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first.value(), 0);
+    EXPECT_EQ(ingest.releasable_up_to(0), 0); // buffer A被挂起的帧钉住
+
+    auto second = ingest.ingest(1, 0, buffer_b.size());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second.value(), frame_size);
+
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received[0], "crosses two fixed buffers");
+    EXPECT_EQ(ingest.pending_bytes(), 0);
+    EXPECT_EQ(ingest.releasable_up_to(0), buffer_a.size()); // 可整体回收
+}
+
+TEST_F(RegisteredBuffersTest, RejectsUnknownBufferAndOutOfRangeSlices) {
+    std::vector<uint8_t> buffer(64);
+    registered_buffer_ingest ingest(*processor);
+    ingest.register_buffer(3, buffer);
+
+    EXPECT_FALSE(ingest.ingest(9, 0, 16).has_value());  // 未注册的buffer id
+    EXPECT_FALSE(ingest.ingest(3, 60, 16).has_value()); // 越过缓冲区末尾
+}
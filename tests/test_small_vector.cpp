@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "http_parse.hpp"
+#include <string>
+
+using namespace co::http;
+
+class SmallVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+// =============================================================================
+// header_list 内联存储测试
+// =============================================================================
+
+TEST_F(SmallVectorTest, InlineCapacityAvoidsHeapAllocation) {
+    header_list headers;
+
+    EXPECT_EQ(headers.capacity(), 16);
+    EXPECT_TRUE(headers.empty());
+
+    const header* inline_data = headers.data();
+    for (int i = 0; i < 16; ++i) {
+        headers.emplace_back("name-" + std::to_string(i), "value");
+    }
+
+    // 16个条目以内不应发生重新分配
+    EXPECT_EQ(headers.data(), inline_data);
+    EXPECT_EQ(headers.size(), 16);
+}
+
+TEST_F(SmallVectorTest, SpillsToHeapBeyondInlineCapacity) {
+    header_list headers;
+    for (int i = 0; i < 40; ++i) {
+        headers.emplace_back("name-" + std::to_string(i), std::to_string(i));
+    }
+
+    EXPECT_EQ(headers.size(), 40);
+    EXPECT_GE(headers.capacity(), 40);
+    for (int i = 0; i < 40; ++i) {
+        EXPECT_EQ(headers[i].value, std::to_string(i));
+    }
+}
+
+TEST_F(SmallVectorTest, InitializerListAssignment) {
+    header_list headers = {{"host", "example.com"}, {"accept", "*/*"}};
+
+    ASSERT_EQ(headers.size(), 2);
+    EXPECT_EQ(headers[0].name, "host");
+    EXPECT_EQ(headers[1].name, "accept");
+
+    headers = {{"content-type", "application/json"}};
+    ASSERT_EQ(headers.size(), 1);
+    EXPECT_EQ(headers[0].name, "content-type");
+}
+
+TEST_F(SmallVectorTest, MoveTransfersContents) {
+    header_list source = {{"host", "example.com"}};
+    header_list moved = std::move(source);
+
+    ASSERT_EQ(moved.size(), 1);
+    EXPECT_EQ(moved[0].value, "example.com");
+    EXPECT_TRUE(source.empty());
+}
+
+TEST_F(SmallVectorTest, MessageHeaderOperationsStillWork) {
+    request req;
+    req.add_header("Host", "example.com");
+    req.add_header("Accept", "*/*");
+    req.set_header("accept", "application/json");
+
+    EXPECT_EQ(req.headers.size(), 2);
+    auto accept = req.get_header("accept");
+    ASSERT_TRUE(accept.has_value());
+    EXPECT_EQ(*accept, "application/json");
+
+    req.remove_header("host");
+    EXPECT_FALSE(req.has_header("host"));
+    EXPECT_EQ(req.headers.size(), 1);
+}
@@ -580,4 +580,106 @@ TEST_F(UnifiedApiTest, HeaderCaseInsensitivity) {
   EXPECT_TRUE(host_found);
   EXPECT_TRUE(content_type_found);
   EXPECT_TRUE(user_agent_found);
+}
+
+TEST_F(UnifiedApiTest, VectoredH2FrameParsing) {
+  // readv风格的多缓冲区输入：只有跨边界的帧被重组，整帧就地解析
+  auto make_data_frame = [](uint32_t stream_id, std::string_view body,
+                            uint8_t flags) {
+    std::vector<uint8_t> frame(9 + body.size());
+    frame[0] = (body.size() >> 16) & 0xFF;
+    frame[1] = (body.size() >> 8) & 0xFF;
+    frame[2] = body.size() & 0xFF;
+    frame[3] = 0x00; // DATA
+    frame[4] = flags;
+    frame[5] = (stream_id >> 24) & 0x7F;
+    frame[6] = (stream_id >> 16) & 0xFF;
+    frame[7] = (stream_id >> 8) & 0xFF;
+    frame[8] = stream_id & 0xFF;
+    std::copy(body.begin(), body.end(), frame.begin() + 9);
+    return frame;
+  };
+
+  auto frame1 = make_data_frame(1, "hello", 0);
+  auto frame2 = make_data_frame(3, "world!", 0x01);
+  std::vector<uint8_t> stream;
+  stream.insert(stream.end(), frame1.begin(), frame1.end());
+  stream.insert(stream.end(), frame2.begin(), frame2.end());
+
+  parser p(version::http_2_0);
+  std::vector<std::pair<uint32_t, std::string>> chunks;
+  p.set_stream_data_callback(
+      [&](uint32_t stream_id, std::span<const uint8_t> data, bool) {
+        chunks.emplace_back(stream_id,
+                            std::string(data.begin(), data.end()));
+      });
+
+  // 切分点落在第一帧载荷和第二帧帧头中间
+  std::vector<std::span<const uint8_t>> buffers = {
+      std::span<const uint8_t>(stream.data(), 11),
+      std::span<const uint8_t>(stream.data() + 11, 7),
+      std::span<const uint8_t>(stream.data() + 18, stream.size() - 18),
+  };
+
+  auto result =
+      p.parse_h2_frames(std::span<const std::span<const uint8_t>>(buffers));
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result.value(), stream.size());
+
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(chunks[0].first, 1);
+  EXPECT_EQ(chunks[0].second, "hello");
+  EXPECT_EQ(chunks[1].first, 3);
+  EXPECT_EQ(chunks[1].second, "world!");
+
+  // 数据在帧中途用尽：与连续版本一致地报告need_more_data
+  std::vector<std::span<const uint8_t>> truncated = {
+      std::span<const uint8_t>(stream.data(), 11),
+      std::span<const uint8_t>(stream.data() + 11, 2),
+  };
+  auto partial =
+      p.parse_h2_frames(std::span<const std::span<const uint8_t>>(truncated));
+  ASSERT_FALSE(partial.has_value());
+  EXPECT_EQ(partial.error(), error_code::need_more_data);
+}
+
+TEST_F(UnifiedApiTest, HeaderIndexRepeatedLookupsOnLargeMessage) {
+  // 超过惰性索引阈值的大消息：反复查找走哈希索引，结果必须与线性扫描一致
+  request req;
+  for (int i = 0; i < 30; ++i) {
+    req.add_header("x-header-" + std::to_string(i), std::to_string(i));
+  }
+  req.add_header("duplicate", "first");
+  req.add_header("duplicate", "second");
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 30; ++i) {
+      auto value = req.get_header("X-Header-" + std::to_string(i));
+      ASSERT_TRUE(value.has_value());
+      EXPECT_EQ(*value, std::to_string(i));
+    }
+    EXPECT_FALSE(req.has_header("x-header-30"));
+  }
+
+  // 重名头部返回首个出现的值
+  EXPECT_EQ(req.get_header("duplicate"), "first");
+}
+
+TEST_F(UnifiedApiTest, HeaderIndexInvalidatedByMutation) {
+  request req;
+  for (int i = 0; i < 20; ++i) {
+    req.add_header("h" + std::to_string(i), "v");
+  }
+  ASSERT_TRUE(req.get_header("h5").has_value()); // 触发索引构建
+
+  // 数量不变的改动（删一个再加一个）也必须让索引失效
+  req.remove_header("h5");
+  req.add_header("h-new", "fresh");
+  EXPECT_FALSE(req.has_header("h5"));
+  EXPECT_EQ(req.get_header("h-new"), "fresh");
+
+  // 绕过访问器直接改动headers：按存储校验惰性重建
+  ASSERT_TRUE(req.get_header("h6").has_value());
+  req.headers.push_back({"pushed-directly", "raw"});
+  EXPECT_EQ(req.get_header("pushed-directly"), "raw");
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "http_parse/uri.hpp"
+#include <string>
+#include <vector>
+
+using namespace co::http;
+
+class UriViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前的设置
+    }
+
+    void TearDown() override {
+        // 每个测试后的清理
+    }
+};
+
+TEST_F(UriViewTest, SplitsPathQueryAndFragment) {
+    std::string target = "/users/42?id=7&lang=en#top";
+    uri_view uri(target);
+
+    EXPECT_EQ(uri.raw(), target);
+    EXPECT_EQ(uri.path(), "/users/42");
+    EXPECT_EQ(uri.query(), "id=7&lang=en");
+    EXPECT_EQ(uri.fragment(), "top");
+    EXPECT_TRUE(uri.has_query());
+    EXPECT_TRUE(uri.has_fragment());
+
+    // 所有组件视图都指向原始字符串内部（零拷贝）
+    EXPECT_GE(uri.path().data(), target.data());
+    EXPECT_LE(uri.fragment().data() + uri.fragment().size(),
+              target.data() + target.size());
+}
+
+TEST_F(UriViewTest, PathOnlyTarget) {
+    uri_view uri("/healthz");
+    EXPECT_EQ(uri.path(), "/healthz");
+    EXPECT_TRUE(uri.query().empty());
+    EXPECT_TRUE(uri.fragment().empty());
+    EXPECT_FALSE(uri.has_query());
+    EXPECT_FALSE(uri.has_fragment());
+}
+
+TEST_F(UriViewTest, FragmentWithoutQueryAndQuestionMarkInFragment) {
+    // '#'优先于'?'：片段里的'?'不算查询
+    uri_view uri("/doc#section?not-a-query");
+    EXPECT_EQ(uri.path(), "/doc");
+    EXPECT_FALSE(uri.has_query());
+    EXPECT_EQ(uri.fragment(), "section?not-a-query");
+}
+
+TEST_F(UriViewTest, QueryParamIterationWithoutAllocation) {
+    uri_view uri("/search?q=http&&flag&empty=&x=1");
+
+    std::vector<uri_view::query_param> params;
+    for (const auto& param : uri.query_params()) {
+        params.push_back(param);
+    }
+
+    ASSERT_EQ(params.size(), 4); // 空段"&&"被跳过
+    EXPECT_EQ(params[0].key, "q");
+    EXPECT_EQ(params[0].value, "http");
+    EXPECT_EQ(params[1].key, "flag"); // 无'='：值为空
+    EXPECT_TRUE(params[1].value.empty());
+    EXPECT_EQ(params[2].key, "empty");
+    EXPECT_TRUE(params[2].value.empty());
+    EXPECT_EQ(params[3].key, "x");
+    EXPECT_EQ(params[3].value, "1");
+
+    auto q = uri.query_param_value("q");
+    ASSERT_TRUE(q.has_value());
+    EXPECT_EQ(*q, "http");
+    EXPECT_FALSE(uri.query_param_value("missing").has_value());
+}
+
+TEST_F(UriViewTest, PercentDecodeOnlyMaterializesWhenNeeded) {
+    std::string scratch;
+
+    // 无转义：原视图直接返回，scratch不被触碰
+    std::string plain = "/already/plain";
+    auto decoded = percent_decode(plain, scratch);
+    EXPECT_EQ(decoded.data(), plain.data());
+    EXPECT_TRUE(scratch.empty());
+
+    // 有转义：物化到scratch
+    decoded = percent_decode("/a%20b%2Fc", scratch);
+    EXPECT_EQ(decoded, "/a b/c");
+    EXPECT_EQ(decoded.data(), scratch.data());
+
+    // 表单编码的查询值：'+'按空格解码
+    decoded = percent_decode("hello+world%21", scratch, true);
+    EXPECT_EQ(decoded, "hello world!");
+}
+
+TEST_F(UriViewTest, PercentDecodePassesMalformedEscapesThrough) {
+    std::string scratch;
+    EXPECT_EQ(percent_decode("100%G1", scratch), "100%G1");
+    EXPECT_EQ(percent_decode("truncated%4", scratch), "truncated%4");
+    EXPECT_EQ(percent_decode("%", scratch), "%");
+}
@@ -0,0 +1,190 @@
+// 捕获回放剖析工具：mmap一个捕获文件（格式见 include/http_parse/capture.hpp），
+// 按原始read边界全速回放，报告吞吐（bytes/sec）与堆分配计数。
+//
+// 用法: http_parse_replay <capture-file> <http1|http1-incremental|h2>
+//
+//   http1              每条记录作为完整消息走 http1::parse_request
+//   http1-incremental  记录流经可续传的增量状态机（模拟真实read分片）
+//   h2                 记录喂给 frame_processor::process_frames
+
+#include "http_parse.hpp"
+#include "http_parse/capture.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// ---------------------------------------------------------------------------
+// 分配计数：替换全局operator new/delete，回放时统计次数与字节数
+// ---------------------------------------------------------------------------
+
+static std::atomic<uint64_t> g_alloc_count{0};
+static std::atomic<uint64_t> g_alloc_bytes{0};
+static bool g_counting = false;
+
+void* operator new(std::size_t size) {
+    if (g_counting) {
+        g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+        g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+struct replay_result {
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    uint64_t messages = 0;
+    uint64_t errors = 0;
+};
+
+replay_result ReplayHttp1(co::http::capture_reader& reader) {
+    replay_result result;
+    while (auto record = reader.next()) {
+        ++result.records;
+        result.bytes += record->size();
+        std::string_view view(reinterpret_cast<const char*>(record->data()), record->size());
+        auto parsed = co::http::http1::parse_request(view);
+        parsed ? ++result.messages : ++result.errors;
+    }
+    return result;
+}
+
+replay_result ReplayHttp1Incremental(co::http::capture_reader& reader) {
+    replay_result result;
+    co::http::http1::request_parser parser;
+    co::http::request req;
+    while (auto record = reader.next()) {
+        ++result.records;
+        result.bytes += record->size();
+        std::span<const char> chunk(reinterpret_cast<const char*>(record->data()),
+                                    record->size());
+        // 一条记录里可能结束一条消息并开始下一条
+        while (!chunk.empty()) {
+            auto consumed = parser.parse(chunk, req);
+            if (!consumed) {
+                ++result.errors;
+                parser.reset();
+                req = {};
+                break;
+            }
+            if (parser.is_complete()) {
+                ++result.messages;
+                parser.reset();
+                req = {};
+            }
+            if (*consumed == 0) {
+                break; // 等待更多数据
+            }
+            chunk = chunk.subspan(*consumed);
+        }
+    }
+    return result;
+}
+
+replay_result ReplayH2(co::http::capture_reader& reader) {
+    replay_result result;
+    co::http::v2::frame_processor processor;
+    processor.set_headers_callback([&](uint32_t, const std::vector<co::http::header>&, bool, bool) {
+        ++result.messages;
+    });
+    while (auto record = reader.next()) {
+        ++result.records;
+        result.bytes += record->size();
+        std::span<const uint8_t> data(record->data(), record->size());
+        // 捕获开头可能带连接前言
+        if (result.records == 1) {
+            if (auto preface = processor.process_connection_preface(data); preface && *preface > 0) {
+                data = data.subspan(*preface);
+            }
+        }
+        if (!processor.process_frames(data)) {
+            ++result.errors;
+            processor.reset();
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <capture-file> <http1|http1-incremental|h2>\n", argv[0]);
+        return 2;
+    }
+
+    int fd = ::open(argv[1], O_RDONLY);
+    if (fd < 0) {
+        std::perror("open");
+        return 1;
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        std::perror("fstat");
+        return 1;
+    }
+    void* mapped = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::perror("mmap");
+        return 1;
+    }
+
+    co::http::capture_reader reader(
+        {static_cast<const uint8_t*>(mapped), static_cast<size_t>(st.st_size)});
+    if (!reader.valid()) {
+        std::fprintf(stderr, "not a capture file (bad magic): %s\n", argv[1]);
+        return 1;
+    }
+
+    std::string_view mode = argv[2];
+    g_alloc_count = 0;
+    g_alloc_bytes = 0;
+    g_counting = true;
+    auto start = std::chrono::steady_clock::now();
+
+    replay_result result;
+    if (mode == "http1") {
+        result = ReplayHttp1(reader);
+    } else if (mode == "http1-incremental") {
+        result = ReplayHttp1Incremental(reader);
+    } else if (mode == "h2") {
+        result = ReplayH2(reader);
+    } else {
+        std::fprintf(stderr, "unknown mode: %s\n", argv[2]);
+        return 2;
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    g_counting = false;
+
+    double mb_per_sec = elapsed > 0 ? result.bytes / elapsed / (1024.0 * 1024.0) : 0.0;
+    std::printf("mode:         %s\n", argv[2]);
+    std::printf("records:      %llu\n", static_cast<unsigned long long>(result.records));
+    std::printf("bytes:        %llu\n", static_cast<unsigned long long>(result.bytes));
+    std::printf("messages:     %llu\n", static_cast<unsigned long long>(result.messages));
+    std::printf("errors:       %llu\n", static_cast<unsigned long long>(result.errors));
+    std::printf("elapsed:      %.3f s\n", elapsed);
+    std::printf("throughput:   %.1f MB/s\n", mb_per_sec);
+    std::printf("allocations:  %llu (%llu bytes)\n",
+                static_cast<unsigned long long>(g_alloc_count.load()),
+                static_cast<unsigned long long>(g_alloc_bytes.load()));
+
+    ::munmap(mapped, static_cast<size_t>(st.st_size));
+    ::close(fd);
+    return 0;
+}